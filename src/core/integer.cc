@@ -71,8 +71,6 @@ constexpr unsigned int SHORT_PER_LONG = (sizeof(long) + sizeof(short) - 1) / siz
 constexpr int MIN_INTREP_SIZE = 16;
 constexpr unsigned int MALLOC_MIN_OVERHEAD = 4;
 
-static IntegerRep ZeroRep = {0, 0, I_POSITIVE, {0}};
-
 // utilities to extract and transfer bits
 
 // get low bits
@@ -317,7 +315,7 @@ IntegerRep *Icopy_ulong(IntegerRep *old, unsigned long x)
   unsigned short srclen = 0;
   while (x != 0) {
     src[srclen++] = extract(x);
-    x = down(x);
+    x >>= I_SHIFT;
   }
 
   IntegerRep *rep;
@@ -342,7 +340,8 @@ IntegerRep *Icopy_ulong(IntegerRep *old, unsigned long x)
 IntegerRep *Icopy_zero(IntegerRep *old)
 {
   if (old == nullptr || IsStaticIntegerRep(old)) {
-    return &ZeroRep;
+    // Callers may go on to write to the result, so this cannot be a shared static zero
+    old = Inew(0);
   }
 
   old->len = 0;
@@ -365,6 +364,116 @@ IntegerRep *Icopy_one(IntegerRep *old, int newsgn)
   return old;
 }
 
+//========================================================================
+//                   Native representation of small values
+//========================================================================
+
+// Values which fit in a long, other than the most negative one, are held natively.
+// Excluding the most negative value means negation and absolute value cannot
+// overflow.  The checked operations below return true if the result would not be
+// held natively, in which case the operation is done on IntegerReps instead.
+
+static bool IsSmallValue(long x) { return x != std::numeric_limits<long>::min(); }
+
+static bool AddOverflows(long x, long y, long &z)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_add_overflow(x, y, &z) || !IsSmallValue(z);
+#else
+  if ((y > 0 && x > std::numeric_limits<long>::max() - y) ||
+      (y < 0 && x < std::numeric_limits<long>::min() - y)) {
+    return true;
+  }
+  z = x + y;
+  return !IsSmallValue(z);
+#endif
+}
+
+static bool SubOverflows(long x, long y, long &z)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_sub_overflow(x, y, &z) || !IsSmallValue(z);
+#else
+  if ((y < 0 && x > std::numeric_limits<long>::max() + y) ||
+      (y > 0 && x < std::numeric_limits<long>::min() + y)) {
+    return true;
+  }
+  z = x - y;
+  return !IsSmallValue(z);
+#endif
+}
+
+static bool MulOverflows(long x, long y, long &z)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_mul_overflow(x, y, &z) || !IsSmallValue(z);
+#else
+  if (x != 0 && magnitude(y) > static_cast<unsigned long>(std::numeric_limits<long>::max()) /
+                                   magnitude(x)) {
+    return true;
+  }
+  z = x * y;
+  return false;
+#endif
+}
+
+/// Provides read-only access to the value of an Integer as an IntegerRep,
+/// building a temporary one if the value is held natively.
+class Integer::RepView {
+public:
+  explicit RepView(const Integer &x)
+    : m_temp(x.IsSmall() ? Icopy_long(nullptr, x.m_value) : nullptr),
+      m_rep(x.IsSmall() ? m_temp : x.rep)
+  {
+  }
+  RepView(const RepView &) = delete;
+  ~RepView() { Ifree(m_temp); }
+  RepView &operator=(const RepView &) = delete;
+
+  operator const IntegerRep *() const { return m_rep; }
+  const IntegerRep *operator->() const { return m_rep; }
+
+private:
+  IntegerRep *m_temp;
+  const IntegerRep *m_rep;
+};
+
+void Integer::FreeRep() noexcept
+{
+  Ifree(rep);
+  rep = nullptr;
+}
+
+void Integer::SetRep(IntegerRep *p_rep)
+{
+  rep = p_rep;
+  if (Iislong(rep)) {
+    const long value = Itolong(rep);
+    if (IsSmallValue(value)) {
+      FreeRep();
+      m_value = value;
+    }
+  }
+}
+
+void Integer::Promote()
+{
+  if (IsSmall()) {
+    rep = Icopy_long(nullptr, m_value);
+  }
+}
+
+double Integer::AsDouble() const
+{
+  // Conversion of an IntegerRep builds up the value one bit at a time, which is
+  // exact only for values of at most 53 bits.
+  constexpr unsigned long long exact = 1ULL << std::numeric_limits<double>::digits;
+  if (IsSmall() && magnitude(m_value) <= exact) {
+    return static_cast<double>(m_value);
+  }
+  return Itodouble(RepView(*this));
+}
+
 // convert to a legal two's complement long if possible
 // if too big, return most negative/positive value
 
@@ -490,6 +599,20 @@ int Iisdouble(const IntegerRep *rep)
 
 double ratio(const Integer &num, const Integer &den)
 {
+  // For natively-held values of at most 53 bits, the computation below is exact
+  // up to the final division and addition, and can be done directly
+  constexpr unsigned long long exact = 1ULL << std::numeric_limits<double>::digits;
+  if (num.IsSmall() && den.IsSmall() && den.m_value != 0 && magnitude(num.m_value) <= exact &&
+      magnitude(den.m_value) < exact) {
+    const long q = num.m_value / den.m_value;
+    const long r = num.m_value % den.m_value;
+    if (r == 0) {
+      return static_cast<double>(q);
+    }
+    return static_cast<double>(q) +
+           static_cast<double>(r) / static_cast<double>(den.m_value);
+  }
+
   Integer q, r;
   divide(num, den, q, r);
   const double d1 = q.as_double();
@@ -503,7 +626,8 @@ double ratio(const Integer &num, const Integer &den)
     double d2 = 0.0;
     double d3 = 0.0;
     int cont = 1;
-    for (int i = den.rep->len - 1; i >= 0 && cont; --i) {
+    const Integer::RepView denRep(den), rRep(r);
+    for (int i = denRep->len - 1; i >= 0 && cont; --i) {
       auto a = static_cast<unsigned short>(I_RADIX >> 1);
       while (a != 0) {
         if (d2 + 1.0 == d2) // out of precision when we get here
@@ -513,13 +637,13 @@ double ratio(const Integer &num, const Integer &den)
         }
 
         d2 *= 2.0;
-        if (den.rep->s[i] & a) {
+        if (denRep->s[i] & a) {
           d2 += 1.0;
         }
 
-        if (i < r.rep->len) {
+        if (i < rRep->len) {
           d3 *= 2.0;
-          if (r.rep->s[i] & a) {
+          if (rRep->s[i] & a) {
             d3 += 1.0;
           }
         }
@@ -528,7 +652,7 @@ double ratio(const Integer &num, const Integer &den)
       }
     }
 
-    if (sign(r) < 0) {
+    if (sign(r) * sign(den) < 0) {
       d3 = -d3;
     }
     return d1 + d3 / d2;
@@ -591,7 +715,7 @@ int compare(const IntegerRep *x, long y)
         int yl = 0;
         while (uy != 0) {
           tmp[yl++] = extract(uy);
-          uy = down(uy);
+          uy >>= I_SHIFT;
         }
         diff = xl - yl;
         if (diff == 0) {
@@ -620,7 +744,7 @@ int ucompare(const IntegerRep *x, long y)
       int yl = 0;
       while (uy != 0) {
         tmp[yl++] = extract(uy);
-        uy = down(uy);
+        uy >>= I_SHIFT;
       }
       diff = xl - yl;
       if (diff == 0) {
@@ -781,10 +905,10 @@ IntegerRep *add(const IntegerRep *x, int negatex, long y, IntegerRep *r)
     const unsigned short *as = (xrsame) ? r->s : x->s;
     const unsigned short *topa = &(as[xl]);
     unsigned long sum = 0;
-    while (as < topa && uy != 0) {
+    while (uy != 0) {
       const unsigned long u = extract(uy);
-      uy = down(uy);
-      sum += static_cast<unsigned long>(*as++) + u;
+      uy >>= I_SHIFT;
+      sum += ((as < topa) ? static_cast<unsigned long>(*as++) : 0UL) + u;
       *rs++ = extract(sum);
       sum = down(sum);
     }
@@ -807,7 +931,7 @@ IntegerRep *add(const IntegerRep *x, int negatex, long y, IntegerRep *r)
     int yl = 0;
     while (uy != 0) {
       tmp[yl++] = extract(uy);
-      uy = down(uy);
+      uy >>= I_SHIFT;
     }
     int comp = xl - yl;
     if (comp == 0) {
@@ -982,7 +1106,7 @@ IntegerRep *multiply(const IntegerRep *x, long y, IntegerRep *r)
     int yl = 0;
     while (uy != 0) {
       tmp[yl++] = extract(uy);
-      uy = down(uy);
+      uy >>= I_SHIFT;
     }
 
     const int rl = xl + yl;
@@ -1218,7 +1342,7 @@ IntegerRep *div(const IntegerRep *x, long y, IntegerRep *q)
   int yl = 0;
   while (u != 0) {
     ys[yl++] = extract(u);
-    u = down(u);
+    u >>= I_SHIFT;
   }
 
   int comp = xl - yl;
@@ -1243,11 +1367,12 @@ IntegerRep *div(const IntegerRep *x, long y, IntegerRep *q)
     IntegerRep *r = nullptr;
     auto prescale = static_cast<unsigned short>(I_RADIX / (1 + ys[yl - 1]));
     if (prescale != 1) {
-      unsigned long prod =
-          static_cast<unsigned long>(prescale) * static_cast<unsigned long>(ys[0]);
-      ys[0] = extract(prod);
-      prod = down(prod) + static_cast<unsigned long>(prescale) * static_cast<unsigned long>(ys[1]);
-      ys[1] = extract(prod);
+      unsigned long prod = 0;
+      for (int i = 0; i < yl; ++i) {
+        prod = down(prod) +
+               static_cast<unsigned long>(prescale) * static_cast<unsigned long>(ys[i]);
+        ys[i] = extract(prod);
+      }
       r = multiply(x, static_cast<long>(prescale) & I_MAXNUM, r);
     }
     else {
@@ -1269,8 +1394,14 @@ IntegerRep *div(const IntegerRep *x, long y, IntegerRep *q)
 
 void divide(const Integer &Ix, long y, Integer &Iq, long &rem)
 {
-  const IntegerRep *x = Ix.rep;
-  nonnil(x);
+  if (Ix.IsSmall() && y != 0) {
+    const long x = Ix.m_value;
+    Iq.SetSmall(x / y);
+    rem = x % y;
+    return;
+  }
+  const Integer::RepView xView(Ix);
+  const IntegerRep *x = xView;
   IntegerRep *q = Iq.rep;
   const int xl = x->len;
   if (y == 0) {
@@ -1282,7 +1413,7 @@ void divide(const Integer &Ix, long y, Integer &Iq, long &rem)
   int yl = 0;
   while (u != 0) {
     ys[yl++] = extract(u);
-    u = down(u);
+    u >>= I_SHIFT;
   }
 
   int comp = xl - yl;
@@ -1309,11 +1440,12 @@ void divide(const Integer &Ix, long y, Integer &Iq, long &rem)
     IntegerRep *r = nullptr;
     auto prescale = static_cast<unsigned short>(I_RADIX / (1 + ys[yl - 1]));
     if (prescale != 1) {
-      unsigned long prod =
-          static_cast<unsigned long>(prescale) * static_cast<unsigned long>(ys[0]);
-      ys[0] = extract(prod);
-      prod = down(prod) + static_cast<unsigned long>(prescale) * static_cast<unsigned long>(ys[1]);
-      ys[1] = extract(prod);
+      unsigned long prod = 0;
+      for (int i = 0; i < yl; ++i) {
+        prod = down(prod) +
+               static_cast<unsigned long>(prescale) * static_cast<unsigned long>(ys[i]);
+        ys[i] = extract(prod);
+      }
       r = multiply(x, static_cast<long>(prescale) & I_MAXNUM, r);
     }
     else {
@@ -1341,15 +1473,22 @@ void divide(const Integer &Ix, long y, Integer &Iq, long &rem)
   }
   q->sgn = samesign;
   Icheck(q);
-  Iq.rep = q;
+  Iq.SetRep(q);
 }
 
 void divide(const Integer &Ix, const Integer &Iy, Integer &Iq, Integer &Ir)
 {
-  const IntegerRep *x = Ix.rep;
-  nonnil(x);
-  const IntegerRep *y = Iy.rep;
-  nonnil(y);
+  if (Ix.IsSmall() && Iy.IsSmall() && Iy.m_value != 0) {
+    const long x = Ix.m_value;
+    const long y = Iy.m_value;
+    Iq.SetSmall(x / y);
+    Ir.SetSmall(x % y);
+    return;
+  }
+  const Integer::RepView xView(Ix);
+  const Integer::RepView yView(Iy);
+  const IntegerRep *x = xView;
+  const IntegerRep *y = yView;
   IntegerRep *q = Iq.rep;
   IntegerRep *r = Ir.rep;
 
@@ -1405,12 +1544,13 @@ void divide(const Integer &Ix, const Integer &Iy, Integer &Iq, Integer &Ir)
       Icheck(r);
       unscale(r->s, r->len, prescale, r->s);
     }
+    r->sgn = xsgn;
   }
   q->sgn = samesign;
   Icheck(q);
-  Iq.rep = q;
+  Iq.SetRep(q);
   Icheck(r);
-  Ir.rep = r;
+  Ir.SetRep(r);
 }
 
 IntegerRep *mod(const IntegerRep *x, const IntegerRep *y, IntegerRep *r)
@@ -1462,6 +1602,7 @@ IntegerRep *mod(const IntegerRep *x, const IntegerRep *y, IntegerRep *r)
       Icheck(r);
       unscale(r->s, r->len, prescale, r->s);
     }
+    r->sgn = xsgn;
   }
   Icheck(r);
   return r;
@@ -1479,7 +1620,7 @@ IntegerRep *mod(const IntegerRep *x, long y, IntegerRep *r)
   int yl = 0;
   while (u != 0) {
     ys[yl++] = extract(u);
-    u = down(u);
+    u >>= I_SHIFT;
   }
 
   int comp = xl - yl;
@@ -1505,11 +1646,12 @@ IntegerRep *mod(const IntegerRep *x, long y, IntegerRep *r)
   else {
     auto prescale = static_cast<unsigned short>(I_RADIX / (1 + ys[yl - 1]));
     if (prescale != 1) {
-      unsigned long prod =
-          static_cast<unsigned long>(prescale) * static_cast<unsigned long>(ys[0]);
-      ys[0] = extract(prod);
-      prod = down(prod) + static_cast<unsigned long>(prescale) * static_cast<unsigned long>(ys[1]);
-      ys[1] = extract(prod);
+      unsigned long prod = 0;
+      for (int i = 0; i < yl; ++i) {
+        prod = down(prod) +
+               static_cast<unsigned long>(prescale) * static_cast<unsigned long>(ys[i]);
+        ys[i] = extract(prod);
+      }
       r = multiply(x, static_cast<long>(prescale) & I_MAXNUM, r);
     }
     else {
@@ -1523,6 +1665,7 @@ IntegerRep *mod(const IntegerRep *x, long y, IntegerRep *r)
       Icheck(r);
       unscale(r->s, r->len, prescale, r->s);
     }
+    r->sgn = xsgn;
   }
   Icheck(r);
   return r;
@@ -1704,7 +1847,7 @@ IntegerRep *bitop(const IntegerRep *x, long y, IntegerRep *r, char op)
   int l = 0;
   while (u != 0) {
     tmp[l++] = extract(u);
-    u = down(u);
+    u >>= I_SHIFT;
   }
 
   const int xl = x->len;
@@ -1802,40 +1945,40 @@ IntegerRep *Compl(const IntegerRep *src, IntegerRep *r)
 void setbit(Integer &x, long b)
 {
   if (b >= 0) {
+    x.Promote();
     const int bw = static_cast<int>(static_cast<unsigned long>(b) / I_SHIFT);
     const int sw = static_cast<int>(static_cast<unsigned long>(b) % I_SHIFT);
-    const int xl = x.rep ? x.rep->len : 0;
+    const int xl = x.rep->len;
     if (xl <= bw) {
       x.rep = Iresize(x.rep, calc_len(xl, bw + 1, 0));
     }
     x.rep->s[bw] |= (1 << sw);
     Icheck(x.rep);
+    x.SetRep(x.rep);
   }
 }
 
 void clearbit(Integer &x, long b)
 {
   if (b >= 0) {
-    if (x.rep == nullptr) {
-      x.rep = &ZeroRep;
-    }
-    else {
-      const int bw = static_cast<int>(static_cast<unsigned long>(b) / I_SHIFT);
-      const int sw = static_cast<int>(static_cast<unsigned long>(b) % I_SHIFT);
-      if (x.rep->len > bw) {
-        x.rep->s[bw] &= ~(1 << sw);
-      }
+    x.Promote();
+    const int bw = static_cast<int>(static_cast<unsigned long>(b) / I_SHIFT);
+    const int sw = static_cast<int>(static_cast<unsigned long>(b) % I_SHIFT);
+    if (x.rep->len > bw) {
+      x.rep->s[bw] &= ~(1 << sw);
     }
     Icheck(x.rep);
+    x.SetRep(x.rep);
   }
 }
 
 int testbit(const Integer &x, long b)
 {
-  if (x.rep != nullptr && b >= 0) {
+  if (b >= 0) {
+    const Integer::RepView rep(x);
     const int bw = static_cast<int>(static_cast<unsigned long>(b) / I_SHIFT);
     const int sw = static_cast<int>(static_cast<unsigned long>(b) % I_SHIFT);
-    return (bw < x.rep->len && (x.rep->s[bw] & (1 << sw)) != 0);
+    return (bw < rep->len && (rep->s[bw] & (1 << sw)) != 0);
   }
   else {
     return 0;
@@ -2147,7 +2290,13 @@ std::string Itoa(const IntegerRep *x, int base, int width)
   return cvtItoa(x, fmtbase, fmtlen, base, 0, width, 0, ' ', 'X', 0);
 }
 
-std::ostream &operator<<(std::ostream &s, const Integer &y) { return s << Itoa(y.rep); }
+std::ostream &operator<<(std::ostream &s, const Integer &y)
+{
+  if (y.IsSmall()) {
+    return s << std::to_string(y.m_value);
+  }
+  return s << Itoa(y.rep);
+}
 
 std::string cvtItoa(const IntegerRep *x, std::string fmt, int &fmtlen, int base, int showbase,
                     int width, int align_right, char fillchar, char Xcase, int showpos)
@@ -2251,7 +2400,7 @@ std::istream &operator>>(std::istream &s, Integer &y)
 {
   char sgn = 0;
   char ch = 0;
-  y.rep = Icopy_zero(y.rep);
+  y.SetSmall(0);
 
   while (s.get(ch) && std::isspace(static_cast<unsigned char>(ch))) {
   }
@@ -2298,7 +2447,12 @@ std::istream &operator>>(std::istream &s, Integer &y)
 
 bool Integer::OK() const
 {
-  if (rep != nullptr) {
+  if (rep == nullptr) {
+    if (IsSmallValue(m_value)) {
+      return true;
+    }
+  }
+  else {
     const int l = rep->len;
     const int s = rep->sgn;
     int v = l <= rep->sz || IsStaticIntegerRep(rep); // length within bounds
@@ -2316,113 +2470,261 @@ bool Integer::OK() const
 
 void Integer::error(const char *msg) { throw std::runtime_error(msg); }
 
-Integer::Integer() : rep(&ZeroRep) {}
+Integer::Integer(long y)
+{
+  if (IsSmallValue(y)) {
+    m_value = y;
+  }
+  else {
+    rep = Icopy_long(nullptr, y);
+  }
+}
 
-Integer::~Integer() { Ifree(rep); }
+Integer::Integer(unsigned long y)
+{
+  if (y <= static_cast<unsigned long>(std::numeric_limits<long>::max())) {
+    m_value = static_cast<long>(y);
+  }
+  else {
+    rep = Icopy_ulong(nullptr, y);
+  }
+}
 
 Integer &Integer::operator=(const Integer &y)
 {
-  rep = Icopy(rep, y.rep);
+  if (y.IsSmall()) {
+    SetSmall(y.m_value);
+  }
+  else {
+    rep = Icopy(rep, y.rep);
+  }
   return *this;
 }
 
 Integer &Integer::operator=(long y)
 {
-  rep = Icopy_long(rep, y);
+  if (IsSmallValue(y)) {
+    SetSmall(y);
+  }
+  else {
+    rep = Icopy_long(rep, y);
+  }
   return *this;
 }
 
 // procedural versions
+//
+// Each operation is done natively when its operands are held natively and the
+// result does not overflow, and otherwise on IntegerReps.
 
-int compare(const Integer &x, const Integer &y) { return compare(x.rep, y.rep); }
+static int compare_long(long x, long y) { return (x < y) ? -1 : ((x > y) ? 1 : 0); }
 
-int ucompare(const Integer &x, const Integer &y) { return ucompare(x.rep, y.rep); }
+int compare(const Integer &x, const Integer &y)
+{
+  if (x.IsSmall() && y.IsSmall()) {
+    return compare_long(x.m_value, y.m_value);
+  }
+  return compare(Integer::RepView(x), Integer::RepView(y));
+}
 
-int compare(const Integer &x, long y) { return compare(x.rep, y); }
+int ucompare(const Integer &x, const Integer &y)
+{
+  if (x.IsSmall() && y.IsSmall()) {
+    const unsigned long ux = magnitude(x.m_value);
+    const unsigned long uy = magnitude(y.m_value);
+    return (ux < uy) ? -1 : ((ux > uy) ? 1 : 0);
+  }
+  return ucompare(Integer::RepView(x), Integer::RepView(y));
+}
+
+int compare(const Integer &x, long y)
+{
+  if (x.IsSmall()) {
+    return compare_long(x.m_value, y);
+  }
+  return compare(x.rep, y);
+}
 
-int ucompare(const Integer &x, long y) { return ucompare(x.rep, y); }
+int ucompare(const Integer &x, long y)
+{
+  if (x.IsSmall()) {
+    const unsigned long ux = magnitude(x.m_value);
+    const unsigned long uy = magnitude(y);
+    return (ux < uy) ? -1 : ((ux > uy) ? 1 : 0);
+  }
+  return ucompare(x.rep, y);
+}
 
-int compare(long x, const Integer &y) { return -compare(y.rep, x); }
+int compare(long x, const Integer &y) { return -compare(y, x); }
 
-int ucompare(long x, const Integer &y) { return -ucompare(y.rep, x); }
+int ucompare(long x, const Integer &y) { return -ucompare(y, x); }
 
 void add(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = add(x.rep, 0, y.rep, 0, dest.rep);
+  long z;
+  if (x.IsSmall() && y.IsSmall() && !AddOverflows(x.m_value, y.m_value, z)) {
+    dest.SetSmall(z);
+    return;
+  }
+  dest.SetRep(add(Integer::RepView(x), 0, Integer::RepView(y), 0, dest.rep));
 }
 
 void sub(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = add(x.rep, 0, y.rep, 1, dest.rep);
+  long z;
+  if (x.IsSmall() && y.IsSmall() && !SubOverflows(x.m_value, y.m_value, z)) {
+    dest.SetSmall(z);
+    return;
+  }
+  dest.SetRep(add(Integer::RepView(x), 0, Integer::RepView(y), 1, dest.rep));
 }
 
 void mul(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = multiply(x.rep, y.rep, dest.rep);
+  long z;
+  if (x.IsSmall() && y.IsSmall() && !MulOverflows(x.m_value, y.m_value, z)) {
+    dest.SetSmall(z);
+    return;
+  }
+  dest.SetRep(multiply(Integer::RepView(x), Integer::RepView(y), dest.rep));
 }
 
 void div(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = div(x.rep, y.rep, dest.rep);
+  if (x.IsSmall() && y.IsSmall() && y.m_value != 0) {
+    dest.SetSmall(x.m_value / y.m_value);
+    return;
+  }
+  dest.SetRep(div(Integer::RepView(x), Integer::RepView(y), dest.rep));
 }
 
 void mod(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = mod(x.rep, y.rep, dest.rep);
+  if (x.IsSmall() && y.IsSmall() && y.m_value != 0) {
+    dest.SetSmall(x.m_value % y.m_value);
+    return;
+  }
+  dest.SetRep(mod(Integer::RepView(x), Integer::RepView(y), dest.rep));
 }
 
 void lshift(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = lshift(x.rep, y.rep, 0, dest.rep);
+  dest.SetRep(lshift(Integer::RepView(x), Integer::RepView(y), 0, dest.rep));
 }
 
 void rshift(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = lshift(x.rep, y.rep, 1, dest.rep);
+  dest.SetRep(lshift(Integer::RepView(x), Integer::RepView(y), 1, dest.rep));
 }
 
 void pow(const Integer &x, const Integer &y, Integer &dest)
 {
-  dest.rep = power(x.rep, Itolong(y.rep), dest.rep); // not incorrect
+  dest.SetRep(power(Integer::RepView(x), y.as_long(), dest.rep)); // not incorrect
 }
 
-void add(const Integer &x, long y, Integer &dest) { dest.rep = add(x.rep, 0, y, dest.rep); }
+void add(const Integer &x, long y, Integer &dest)
+{
+  long z;
+  if (x.IsSmall() && !AddOverflows(x.m_value, y, z)) {
+    dest.SetSmall(z);
+    return;
+  }
+  dest.SetRep(add(Integer::RepView(x), 0, y, dest.rep));
+}
 
 void sub(const Integer &x, long y, Integer &dest)
 {
+  long z;
+  if (x.IsSmall() && !SubOverflows(x.m_value, y, z)) {
+    dest.SetSmall(z);
+    return;
+  }
   const Integer yy(y);
   sub(x, yy, dest);
 }
 
-void mul(const Integer &x, long y, Integer &dest) { dest.rep = multiply(x.rep, y, dest.rep); }
+void mul(const Integer &x, long y, Integer &dest)
+{
+  long z;
+  if (x.IsSmall() && !MulOverflows(x.m_value, y, z)) {
+    dest.SetSmall(z);
+    return;
+  }
+  dest.SetRep(multiply(Integer::RepView(x), y, dest.rep));
+}
 
-void div(const Integer &x, long y, Integer &dest) { dest.rep = div(x.rep, y, dest.rep); }
+void div(const Integer &x, long y, Integer &dest)
+{
+  if (x.IsSmall() && y != 0) {
+    dest.SetSmall(x.m_value / y);
+    return;
+  }
+  dest.SetRep(div(Integer::RepView(x), y, dest.rep));
+}
 
-void mod(const Integer &x, long y, Integer &dest) { dest.rep = mod(x.rep, y, dest.rep); }
+void mod(const Integer &x, long y, Integer &dest)
+{
+  if (x.IsSmall() && y != 0) {
+    dest.SetSmall(x.m_value % y);
+    return;
+  }
+  dest.SetRep(mod(Integer::RepView(x), y, dest.rep));
+}
 
-void lshift(const Integer &x, long y, Integer &dest) { dest.rep = lshift(x.rep, y, dest.rep); }
+void lshift(const Integer &x, long y, Integer &dest)
+{
+  dest.SetRep(lshift(Integer::RepView(x), y, dest.rep));
+}
 
 void rshift(const Integer &x, long y, Integer &dest)
 {
   if (y == std::numeric_limits<long>::min()) {
     throw std::overflow_error("Integer shift count too large");
   }
-  dest.rep = lshift(x.rep, -y, dest.rep);
+  dest.SetRep(lshift(Integer::RepView(x), -y, dest.rep));
 }
 
-void pow(const Integer &x, long y, Integer &dest) { dest.rep = power(x.rep, y, dest.rep); }
+void pow(const Integer &x, long y, Integer &dest)
+{
+  dest.SetRep(power(Integer::RepView(x), y, dest.rep));
+}
 
-void abs(const Integer &x, Integer &dest) { dest.rep = abs(x.rep, dest.rep); }
+void abs(const Integer &x, Integer &dest)
+{
+  if (x.IsSmall()) {
+    dest.SetSmall((x.m_value < 0) ? -x.m_value : x.m_value);
+    return;
+  }
+  dest.SetRep(abs(x.rep, dest.rep));
+}
 
-void negate(const Integer &x, Integer &dest) { dest.rep = negate(x.rep, dest.rep); }
+void negate(const Integer &x, Integer &dest)
+{
+  if (x.IsSmall()) {
+    dest.SetSmall(-x.m_value);
+    return;
+  }
+  dest.SetRep(negate(x.rep, dest.rep));
+}
 
-void complement(const Integer &x, Integer &dest) { dest.rep = Compl(x.rep, dest.rep); }
+void complement(const Integer &x, Integer &dest)
+{
+  dest.SetRep(Compl(Integer::RepView(x), dest.rep));
+}
 
-void add(long x, const Integer &y, Integer &dest) { dest.rep = add(y.rep, 0, x, dest.rep); }
+void add(long x, const Integer &y, Integer &dest) { add(y, x, dest); }
 
-void sub(long x, const Integer &y, Integer &dest) { dest.rep = add(y.rep, 1, x, dest.rep); }
+void sub(long x, const Integer &y, Integer &dest)
+{
+  long z;
+  if (y.IsSmall() && !SubOverflows(x, y.m_value, z)) {
+    dest.SetSmall(z);
+    return;
+  }
+  dest.SetRep(add(Integer::RepView(y), 1, x, dest.rep));
+}
 
-void mul(long x, const Integer &y, Integer &dest) { dest.rep = multiply(y.rep, x, dest.rep); }
+void mul(long x, const Integer &y, Integer &dest) { mul(y, x, dest); }
 
 // operator versions
 
@@ -2517,15 +2819,42 @@ void Integer::abs() { Gambit::abs(*this, *this); }
 
 void Integer::negate() { Gambit::negate(*this, *this); }
 
-int sign(const Integer &x) { return (x.rep->len == 0) ? 0 : ((x.rep->sgn == 1) ? 1 : -1); }
+int sign(const Integer &x)
+{
+  if (x.IsSmall()) {
+    return (x.m_value > 0) - (x.m_value < 0);
+  }
+  return (x.rep->len == 0) ? 0 : ((x.rep->sgn == 1) ? 1 : -1);
+}
 
-int even(const Integer &y) { return y.rep->len == 0 || !(y.rep->s[0] & 1); }
+int even(const Integer &y)
+{
+  if (y.IsSmall()) {
+    return (y.m_value & 1) == 0;
+  }
+  return y.rep->len == 0 || !(y.rep->s[0] & 1);
+}
 
-int odd(const Integer &y) { return y.rep->len > 0 && (y.rep->s[0] & 1); }
+int odd(const Integer &y)
+{
+  if (y.IsSmall()) {
+    return (y.m_value & 1) != 0;
+  }
+  return y.rep->len > 0 && (y.rep->s[0] & 1);
+}
 
-std::string Itoa(const Integer &y, int base, int width) { return Itoa(y.rep, base, width); }
+std::string Itoa(const Integer &y, int base, int width)
+{
+  return Itoa(Integer::RepView(y), base, width);
+}
 
-long lg(const Integer &x) { return lg(x.rep); }
+long lg(const Integer &x)
+{
+  if (x.IsSmall()) {
+    return (x.m_value == 0) ? 0 : lg(magnitude(x.m_value));
+  }
+  return lg(x.rep);
+}
 
 // constructive operations
 
@@ -2672,14 +3001,25 @@ Integer Integer::operator-() const
 Integer atoI(const char *s, int base)
 {
   Integer r;
-  r.rep = atoIntegerRep(s, base);
+  r.SetRep(atoIntegerRep(s, base));
   return r;
 }
 
 Integer gcd(const Integer &x, const Integer &y)
 {
   Integer r;
-  r.rep = gcd(x.rep, y.rep);
+  if (x.IsSmall() && y.IsSmall()) {
+    unsigned long u = magnitude(x.m_value);
+    unsigned long v = magnitude(y.m_value);
+    while (v != 0) {
+      const unsigned long t = u % v;
+      u = v;
+      v = t;
+    }
+    r.m_value = static_cast<long>(u);
+    return r;
+  }
+  r.SetRep(gcd(Integer::RepView(x), Integer::RepView(y)));
   return r;
 }
 
@@ -85,18 +85,57 @@ extern long lg(const IntegerRep *);
 
 class Integer {
 protected:
-  IntegerRep *rep;
+  /// The arbitrary-precision representation of the value, or null if the value is
+  /// held natively in m_value.  Every value which fits in a long, except the most
+  /// negative one, is held natively; the arbitrary-precision representation is used
+  /// only when a result overflows.
+  IntegerRep *rep{nullptr};
+  long m_value{0};
+
+  class RepView;
+
+  /// @name Managing the representation
+  //@{
+  /// Returns true if the value is held natively
+  bool IsSmall() const { return rep == nullptr; }
+  /// Frees the arbitrary-precision representation
+  void FreeRep() noexcept;
+  /// Sets the value to p_value, which must not be the most negative long
+  void SetSmall(long p_value)
+  {
+    if (rep != nullptr) {
+      FreeRep();
+    }
+    m_value = p_value;
+  }
+  /// Takes ownership of the arbitrary-precision representation p_rep, reverting
+  /// to the native representation if the value fits
+  void SetRep(IntegerRep *p_rep);
+  /// Converts the value to the arbitrary-precision representation
+  void Promote();
+  /// Converts the value to a double, rounding in the same way whichever
+  /// representation is used
+  double AsDouble() const;
+  //@}
 
 public:
   /// @name Lifecycle
   //@{
-  Integer();
-  explicit Integer(int y) : rep(Icopy_long(nullptr, y)) {}
-  explicit Integer(long y) : rep(Icopy_long(nullptr, y)) {}
-  explicit Integer(unsigned long y) : rep(Icopy_ulong(nullptr, y)) {}
-  explicit Integer(IntegerRep *r) : rep(r) {}
-  Integer(const Integer &y) : rep(Icopy(nullptr, y.rep)) {}
-  ~Integer();
+  Integer() = default;
+  explicit Integer(int y) : Integer(static_cast<long>(y)) {}
+  explicit Integer(long y);
+  explicit Integer(unsigned long y);
+  explicit Integer(IntegerRep *r) { SetRep(r); }
+  Integer(const Integer &y)
+    : rep(y.IsSmall() ? nullptr : Icopy(nullptr, y.rep)), m_value(y.m_value)
+  {
+  }
+  ~Integer()
+  {
+    if (rep != nullptr) {
+      FreeRep();
+    }
+  }
 
   Integer &operator=(const Integer &);
   Integer &operator=(long);
@@ -209,11 +248,11 @@ public:
 
   // coercion & conversion
 
-  int fits_in_long() const { return Iislong(rep); }
-  int fits_in_double() const { return Iisdouble(rep); }
+  int fits_in_long() const { return IsSmall() || Iislong(rep); }
+  int fits_in_double() const { return IsSmall() || Iisdouble(rep); }
 
-  long as_long() const { return Itolong(rep); }
-  double as_double() const { return Itodouble(rep); }
+  long as_long() const { return IsSmall() ? m_value : Itolong(rep); }
+  double as_double() const { return AsDouble(); }
 
   friend std::string Itoa(const Integer &x, int base /*= 10*/, int width /*= 0*/);
   friend Integer atoI(const char *s, int base /*= 10*/);
@@ -222,7 +261,7 @@ public:
   friend std::ostream &operator<<(std::ostream &s, const Integer &y);
 
   // error detection
-  bool initialized() const { return rep != nullptr; }
+  bool initialized() const { return true; }
   static void error(const char *msg);
   bool OK() const;
 };
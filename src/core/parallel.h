@@ -0,0 +1,244 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/core/parallel.h
+// Distributing independent pieces of work across threads
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_CORE_PARALLEL_H
+#define GAMBIT_CORE_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "cancel.h"
+
+namespace Gambit {
+
+/// @brief Returns the number of threads to use for a computation.
+///
+/// A positive p_threads is used as given.  Otherwise, this is the number of
+/// hardware threads available, or one if that cannot be determined.
+inline int GetNumThreads(int p_threads)
+{
+  if (p_threads > 0) {
+    return p_threads;
+  }
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+/// @brief Calls p_body(i) for each i in [0, p_count), distributing the calls
+///        over up to p_numThreads threads.
+///
+/// Indices are handed out to threads one at a time as they become free, so the
+/// calls need not take similar amounts of time.  The calling thread is one of the
+/// threads used.  p_body must be safe to call concurrently for distinct indices.
+///
+/// If a call throws an exception, no further indices are started, and the first
+/// exception thrown is rethrown in the calling thread once all threads have finished.
+template <class F> void ParallelFor(size_t p_count, int p_numThreads, F p_body)
+{
+  const size_t numThreads = std::min(static_cast<size_t>(std::max(p_numThreads, 1)), p_count);
+  if (numThreads <= 1) {
+    for (size_t i = 0; i < p_count; ++i) {
+      p_body(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next{0};
+  std::exception_ptr error;
+  std::mutex errorMutex;
+  auto worker = [&]() {
+    for (size_t i = next++; i < p_count; i = next++) {
+      try {
+        p_body(i);
+      }
+      catch (...) {
+        const std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        next = p_count;
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads - 1);
+  for (size_t t = 1; t < numThreads; ++t) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+/// @brief Processes a stream of items on up to p_numThreads threads, consuming the
+///        results in the order in which the items were produced.
+///
+/// p_next() returns each item in turn as a std::optional, which is empty once the
+/// stream is exhausted; calls to it are serialised.  p_process(item, token) computes
+/// the result for an item, and is called concurrently for distinct items.  The token
+/// passed is canceled once the results of the items in progress are no longer wanted.
+/// p_consume(item, result) is called in the calling thread, in the order of the items,
+/// and returns false if no further results are wanted.
+///
+/// Items are handed out to threads one at a time as they become free.  So that results
+/// waiting on a slow item do not accumulate without bound, at most a few items per thread
+/// are taken beyond the earliest one whose result has not yet been consumed.
+///
+/// An exception thrown by p_next or p_process is rethrown in the calling thread when
+/// the result of that item would have been consumed, so the results consumed and the
+/// exceptions seen are the same as for the serial loop.  If p_cancel is canceled, the
+/// items in progress are abandoned, and ComputationCanceledException is thrown.
+template <class Next, class Process, class Consume>
+void ParallelPipeline(int p_numThreads, const CancelToken &p_cancel, Next p_next,
+                      Process p_process, Consume p_consume)
+{
+  using Item = typename std::invoke_result_t<Next &>::value_type;
+  using Result = std::invoke_result_t<Process &, const Item &, const CancelToken &>;
+
+  if (p_numThreads <= 1) {
+    for (auto item = p_next(); item; item = p_next()) {
+      p_cancel.Check();
+      if (!p_consume(*item, p_process(*item, p_cancel))) {
+        return;
+      }
+    }
+    return;
+  }
+
+  struct Slot {
+    std::optional<Item> item;
+    std::optional<Result> result;
+    std::exception_ptr error;
+    bool done{false};
+  };
+  const size_t window = 4 * static_cast<size_t>(p_numThreads);
+  std::deque<Slot> slots;
+  bool exhausted = false, stopping = false;
+  std::mutex mutex;
+  std::condition_variable ready, space;
+  const CancelToken stop;
+
+  auto worker = [&]() {
+    while (true) {
+      Slot *slot;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        space.wait(lock, [&]() { return stopping || exhausted || slots.size() < window; });
+        if (stopping || exhausted) {
+          return;
+        }
+        slot = &slots.emplace_back();
+        try {
+          slot->item = p_next();
+        }
+        catch (...) {
+          slot->error = std::current_exception();
+        }
+        if (!slot->item) {
+          slot->done = exhausted = true;
+          ready.notify_all();
+          space.notify_all();
+          return;
+        }
+      }
+      std::optional<Result> result;
+      std::exception_ptr error;
+      try {
+        result.emplace(p_process(*slot->item, stop));
+      }
+      catch (...) {
+        error = std::current_exception();
+      }
+      const std::lock_guard<std::mutex> lock(mutex);
+      slot->result = std::move(result);
+      slot->error = error;
+      slot->done = true;
+      ready.notify_all();
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(p_numThreads);
+  auto shutdown = [&]() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    stop.RequestCancel();
+    space.notify_all();
+    for (auto &thread : threads) {
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+  };
+
+  try {
+    for (int t = 0; t < p_numThreads; ++t) {
+      threads.emplace_back(worker);
+    }
+    while (true) {
+      Slot slot;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        // The wait is bounded so that a cancellation request is noticed promptly
+        while ((slots.empty() || !slots.front().done) && !p_cancel.IsCanceled()) {
+          ready.wait_for(lock, std::chrono::milliseconds(10));
+        }
+        if (p_cancel.IsCanceled()) {
+          lock.unlock();
+          shutdown();
+          p_cancel.Check();
+        }
+        slot = std::move(slots.front());
+        slots.pop_front();
+      }
+      space.notify_all();
+      if (slot.error) {
+        std::rethrow_exception(slot.error);
+      }
+      if (!slot.item || !p_consume(*slot.item, std::move(*slot.result))) {
+        break;
+      }
+    }
+  }
+  catch (...) {
+    shutdown();
+    throw;
+  }
+  shutdown();
+}
+
+} // namespace Gambit
+
+#endif // GAMBIT_CORE_PARALLEL_H
@@ -380,15 +380,12 @@ int Rational::fits_in_double() const
 // These were moved from the header file to eliminate warnings
 //
 
-static IntegerRep ZeroRep = {1, 0, 1, {0}};
-static IntegerRep OneRep = {1, 0, 1, {1}};
-
-Rational::Rational() : num(&ZeroRep), den(&OneRep) {}
+Rational::Rational() : num(0), den(1) {}
 Rational::~Rational() = default;
 
 Rational::Rational(const Rational &y) = default;
 
-Rational::Rational(const Integer &n) : num(n), den(&OneRep) {}
+Rational::Rational(const Integer &n) : num(n), den(1) {}
 
 Rational::Rational(const Integer &n, const Integer &d) : num(n), den(d)
 {
@@ -398,11 +395,11 @@ Rational::Rational(const Integer &n, const Integer &d) : num(n), den(d)
   normalize();
 }
 
-Rational::Rational(long n) : num(n), den(&OneRep) {}
+Rational::Rational(long n) : num(n), den(1) {}
 
-Rational::Rational(int n) : num(n), den(&OneRep) {}
+Rational::Rational(int n) : num(n), den(1) {}
 
-Rational::Rational(size_t n) : num(int(n)), den(&OneRep) {}
+Rational::Rational(size_t n) : num(int(n)), den(1) {}
 
 Rational::Rational(long n, long d) : num(n), den(d)
 {
@@ -509,8 +506,52 @@ Rational Rational::operator/(const Rational &y) const
   return r;
 }
 
+// Recognises a decimal of the form [-]ddd[.ddd] with few enough digits that its
+// numerator and denominator fit in a long, as the numbers in game files almost always
+// are, so that these can be converted without arbitrary-precision arithmetic per digit.
+static bool ParseShortDecimal(const std::string &f, long &num, long &denom)
+{
+  const int MaxDigits = 18;
+  size_t index = 0;
+  const bool negative = (!f.empty() && f[0] == '-');
+  if (negative) {
+    index++;
+  }
+  int digits = 0;
+  bool point = false;
+  num = 0;
+  denom = 1;
+  for (; index < f.length(); index++) {
+    const char ch = f[index];
+    if (ch >= '0' && ch <= '9') {
+      if (++digits > MaxDigits) {
+        return false;
+      }
+      num = 10 * num + (ch - '0');
+      if (point) {
+        denom *= 10;
+      }
+    }
+    else if (ch == '.' && !point) {
+      point = true;
+    }
+    else {
+      return false;
+    }
+  }
+  if (negative) {
+    num = -num;
+  }
+  return digits > 0;
+}
+
 template <> Rational lexical_cast(const std::string &f)
 {
+  long shortNum, shortDenom;
+  if (ParseShortDecimal(f, shortNum, shortDenom)) {
+    return {shortNum, shortDenom};
+  }
+
   char ch = ' ';
   int sign = 1;
   unsigned int index = 0, length = f.length();
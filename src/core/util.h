@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <numeric>
 #include <map>
+#include <new>
 #include <optional>
 
 namespace Gambit {
@@ -249,6 +250,28 @@ auto sum_function(const Container &p_container, const Func &p_function)
                                std::plus<>{}, p_function);
 }
 
+/// @brief An allocator which aligns storage to (by default) cache-line boundaries
+///        This is intended for dense numerical arrays which are traversed in inner loops.
+template <class T, std::size_t Align = 64> class AlignedAllocator {
+public:
+  using value_type = T;
+  template <class U> struct rebind {
+    using other = AlignedAllocator<U, Align>;
+  };
+
+  AlignedAllocator() = default;
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  template <class U> AlignedAllocator(const AlignedAllocator<U, Align> &) {}
+
+  T *allocate(std::size_t n)
+  {
+    return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+  }
+  void deallocate(T *p, std::size_t) { ::operator delete(p, std::align_val_t(Align)); }
+
+  bool operator==(const AlignedAllocator &) const { return true; }
+};
+
 //========================================================================
 //                        Exception classes
 //========================================================================
@@ -35,6 +35,7 @@
 #include "games/seqmixed.h"
 
 #include "games/stratspt.h"
+#include "games/stratdom.h"
 #include "games/stratpure.h"
 #include "games/stratmixed.h"
 
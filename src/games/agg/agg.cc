@@ -253,7 +253,7 @@ std::shared_ptr<AGG> AGG::makeAGG(istream &in)
       for (j = 0; j < size[i]; j++) {
         // apply i's strategy j
         Pr[0].reset();
-        Pr[0].insert(make_pair(proj[ASets[i][j]][i][j], 1));
+        Pr[0].insert(proj[ASets[i][j]][i][j], 1.0);
 
         // apply the rest of players strats
         for (int k = 1; k < n; k++) {
@@ -340,7 +340,7 @@ void AGG::setProjections(vector<vector<ConfigDistribution<double>>> &projS,
         } // end for(k..
 
         // insert player i's action j's contribution to projS
-        projS[Node][i].insert(make_pair(proj[Node][i][j], 1));
+        projS[Node][i].insert(proj[Node][i][j], 1.0);
       } // end for(j..
     }   // end for(i..
   }     // end for(Node..
@@ -400,7 +400,7 @@ template <class V> void AGG::computeP(int player, int act, int player2, int act2
   auto &s = state<V>();
   // apply player's strat
   s.Pr[0].reset();
-  s.Pr[0].insert(make_pair(projection[actionSets[player][act]][player][act], V(1)));
+  s.Pr[0].insert(projection[actionSets[player][act]][player][act], V(1));
 
   const int numNei = neighbors[actionSets[player][act]].size();
   // apply others' strat
@@ -412,9 +412,9 @@ template <class V> void AGG::computeP(int player, int act, int player2, int act2
       }
       else {
         // apply player2's pure strat
-        ConfigDistribution<V> temp;
-        temp.insert(make_pair(projection[actionSets[player][act]][player2][act2], V(1)));
-        s.Pr[k].multiply(s.Pr[k - 1], temp, numNei, projFunctions[actionSets[player][act]]);
+        s.pure.reset();
+        s.pure.insert(projection[actionSets[player][act]][player2][act2], V(1));
+        s.Pr[k].multiply(s.Pr[k - 1], s.pure, numNei, projFunctions[actionSets[player][act]]);
       }
     }
     else {
@@ -485,8 +485,10 @@ template Rational AGG::getPurePayoff<Rational>(int player, const std::vector<int
 Rational AGG::exactInnerProd(int node, const ConfigDistribution<Rational> &dist) const
 {
   Rational result(0);
+  Config key;
   for (const auto &entry : dist) {
-    const auto it = exactPayoffs[node].find(entry.first);
+    key.assign(entry.first.begin(), entry.first.end());
+    const auto it = exactPayoffs[node].find(key);
     if (it != exactPayoffs[node].end() && entry.second != Rational(0)) {
       result += entry.second * static_cast<Rational>(it->second);
     }
@@ -584,8 +586,9 @@ void AGG::getPayoffJacobianRow(int player1, int act1, const StrategyProfile<doub
 
   // base[player1] is pinned to the one-hot at act1 (fixed for the whole row); base[k] for
   // every other player k is k's actual projected mixed strategy at Node, computed fresh from s.
-  std::vector<ConfigDistribution<double>> base(numPlayers);
-  base[player1].insert(std::make_pair(projection[Node][player1][act1], 1.0));
+  std::vector<ConfigDistribution<double>> &base = m_state.base;
+  base[player1].reset();
+  base[player1].insert(projection[Node][player1][act1], 1.0);
 
   std::vector<int> others;
   others.reserve(numPlayers - 1);
@@ -594,9 +597,10 @@ void AGG::getPayoffJacobianRow(int player1, int act1, const StrategyProfile<doub
       continue;
     }
     others.push_back(k);
+    base[k].reset();
     for (int j = 0; j < actions[k]; ++j) {
       if (s[j + firstAction(k)] > 0.0) {
-        base[k] += std::make_pair(projection[Node][k][j], s[j + firstAction(k)]);
+        base[k].add(projection[Node][k][j], s[j + firstAction(k)]);
       }
     }
   }
@@ -604,16 +608,15 @@ void AGG::getPayoffJacobianRow(int player1, int act1, const StrategyProfile<doub
     return; // only one player in the game; no off-diagonal entries to fill
   }
 
-  std::vector<ConfigDistribution<double>> allBut(numPlayers);
+  std::vector<ConfigDistribution<double>> &allBut = m_state.allBut;
   if (others.size() == 1) {
     // With only one other player, "everyone except player1 and that player" is nobody, so the
     // induced distribution is just player1's own pinned action.
     allBut[others[0]] = base[player1];
   }
   else {
-    ConfigDistribution<double> temp;
     computeAllButOne(others, size_t{0}, others.size(), base, numNei, projFunctions[Node], allBut,
-                     temp);
+                     m_state.temp);
     for (const int j : others) {
       allBut[j].multiply(base[player1], numNei, projFunctions[Node]);
     }
@@ -694,7 +697,7 @@ double AGG::getSymMixedPayoff(int node, StrategyProfile<double> &s)
 {
   const int numNei = neighbors[node].size();
 
-  if (!isPure[node]) { // then compute EU using trie_map::power()
+  if (!isPure[node]) { // then compute EU using config_map::power()
     doProjection(node, 0, s);
     assert(numPlayers > 1);
     // ConfigDistribution<double> *dest;
@@ -786,15 +789,16 @@ void AGG::getSymConfigProb(int plClass, StrategyProfile<double> &s, int ownPlCla
     if (numPl > 0) {
       for (int j = 0; j < actions[player]; j++) {
         if (s[j] > (double)0.0) {
-          m_state.projectedStrat[node][player] += make_pair(projection[node][player][j], s[j]);
+          m_state.projectedStrat[node][player].add(projection[node][player][j], s[j]);
         }
       }
       m_state.projectedStrat[node][player].power(numPl, dest, m_state.Pr[0], numNei,
                                                  projFunctions[node]);
     }
+    ConfigDistribution<double> &temp = m_state.pure;
     if (plClass == ownPlClass) {
-      ConfigDistribution<double> temp;
-      temp.insert(make_pair(projection[node][player].at(act), 1.0));
+      temp.reset();
+      temp.insert(projection[node][player].at(act), 1.0);
       if (dest.size() > 0) {
         dest.multiply(temp, numNei, projFunctions[node]);
       }
@@ -804,8 +808,8 @@ void AGG::getSymConfigProb(int plClass, StrategyProfile<double> &s, int ownPlCla
       }
     }
     if (plClass == plClass2) {
-      ConfigDistribution<double> temp;
-      temp.insert(make_pair(projection[node][player].at(act2), 1.0));
+      temp.reset();
+      temp.insert(projection[node][player].at(act2), 1.0);
       if (dest.size() > 0) {
         dest.multiply(temp, numNei, projFunctions[node]);
       }
@@ -867,7 +871,7 @@ void AGG::getSymConfigProb(int plClass, StrategyProfile<double> &s, int ownPlCla
     }
 
     // V+= prob *  payoffs[node].find(c)->second ;
-    dest.insert(make_pair(c, prob));
+    dest.insert(c, prob);
 
     // get next composition
     gc.incr();
@@ -926,7 +930,7 @@ double AGG::getKSymMixedPayoff(int playerClass, int act, vector<StrategyProfile<
 
   const int numNei = neighbors[uniqueActionSets[playerClass][act]].size();
 
-  static ConfigDistribution<double> d, temp;
+  ConfigDistribution<double> &d = m_state.symDist, &temp = m_state.symTemp;
   d.reset();
   temp.reset();
   getSymConfigProb(0, s[0], playerClass, act, d);
@@ -942,7 +946,7 @@ double AGG::getKSymMixedPayoff(const StrategyProfile<double> &s, int pClass1, in
 {
   const int numPC = playerClasses.size();
   const int numNei = neighbors[uniqueActionSets[pClass1][act1]].size();
-  static ConfigDistribution<double> d, temp;
+  ConfigDistribution<double> &d = m_state.symDist, &temp = m_state.symTemp;
   if (pClass2 >= 0 && pClass1 == pClass2 && playerClasses.at(pClass1).size() <= 1) {
     return 0;
   }
@@ -1029,7 +1033,7 @@ void AGG::makeMAPPINGpayoff(std::istream &in, PayoffTable &pay, ExactPayoffTable
     const auto u = static_cast<double>(num);
 
     // insert
-    const pair<trie_map<double>::iterator, bool> r = pay.insert(make_pair(key, u));
+    const auto r = pay.insert(key, u);
     if (!r.second) {
       std::stringstream str;
       str << "ERROR: overwriting utility at [";
@@ -1046,7 +1050,7 @@ void AGG::makeMAPPINGpayoff(std::istream &in, PayoffTable &pay, ExactPayoffTable
     }
   }
   // check
-  for (auto &it : temp) {
+  for (const auto &it : temp) {
     if (pay.count(it.first) == 0) {
       std::stringstream str;
       str << "ERROR: utility at [";
@@ -30,7 +30,7 @@
 #include <iterator>
 #include <type_traits>
 #include "proj_func.h"
-#include "trie_map.h"
+#include "config_map.h"
 #include "games/number.h"
 
 namespace Gambit::agg {
@@ -41,33 +41,38 @@ template <class V> using StrategyProfile = std::vector<V>;
 
 // the local payoff function for one action node: maps a neighbor configuration to the payoff of
 // playing that node under it. Populated at parse time; consumed by the floating-point
-// convolution engine (getMixedPayoff/getV/getJ) via trie_map's own inner_prod, so it has to stay
-// a trie_map<double> -- unlike StrategyProfile/ConfigDistribution above, this is deliberately not
-// a template (see ExactPayoffTable below for why a Rational instantiation would be unsound).
-using PayoffTable = trie_map<double>;
+// convolution engine (getMixedPayoff/getV/getJ) via config_map's own inner_prod, so it has to
+// stay a config_map<double> -- unlike StrategyProfile/ConfigDistribution above, this is
+// deliberately not a template (see ExactPayoffTable below for why a Rational instantiation would
+// be unsound).
+using PayoffTable = config_map<double>;
 
 // exact (arbitrary-precision) counterpart of PayoffTable, populated alongside it at parse time
-// from the same source text. Deliberately not a trie_map<Rational>, for two independent reasons:
-// (1) trie_map's own inner_prod has an epsilon-tolerance discard/throw policy
-// (trie_map<V>::THRESH = 1e-12) that is meaningful for double but unsound for exact arithmetic --
+// from the same source text. Deliberately not a config_map<Rational>, for two independent reasons:
+// (1) config_map's own inner_prod has an epsilon-tolerance discard/throw policy
+// (config_map<V>::THRESH = 1e-12) that is meaningful for double but unsound for exact arithmetic --
 // there is no notion of "too small to matter" once payoffs are exact; and (2) this stores Number,
 // not Rational, to preserve the original entered text for exact serialization (printPayoffs),
 // which a bare Rational cannot do. As a result this is only ever used for storage/lookup
-// (find/insert/iterate) and a hand-written inner product (AGG::exactInnerProd), never trie_map's
-// own arithmetic.
+// (find/insert/iterate) and a hand-written inner product (AGG::exactInnerProd), never
+// config_map's own arithmetic.
 using ExactPayoffTable = std::map<std::vector<int>, Number>;
 
 // data struct for a probability distribution over configurations, using numeric type V (double
 // for the floating-point engine, Rational for the exact-arithmetic counterpart). Unlike
 // PayoffTable/ExactPayoffTable above, this participates in the convolution algorithm
 // (multiply/inner_prod), so V must support arithmetic -- which Rational, unlike Number,
-// provides -- letting both instantiations reuse trie_map directly.
-template <class V> using ConfigDistribution = trie_map<V>;
+// provides -- letting both instantiations reuse config_map directly.
+template <class V> using ConfigDistribution = config_map<V>;
 
 // AGG's mutable working state for the convolution algorithm, at numeric type V. AGG holds one
 // instance per V (see AGG::state()) rather than a single instance of one or the other, since both
 // may be in use simultaneously -- e.g. from different MixedStrategyProfile instantiations over
 // the same AGG -- and each is rebuilt fresh per call regardless of its previous contents.
+//
+// Every distribution built while evaluating a payoff lives here, including the temporaries,
+// and config_map::reset() keeps a distribution's storage; so the state serves as the arena for
+// these, and once it has seen the largest distributions of a game, evaluations do not allocate.
 template <class V> struct ConvolutionState {
   // foreach s \in S, foreach i \in N, the projected mixed strat: a prob distribution over the
   // set of 'contributions' (see AGG::projection).
@@ -79,9 +84,22 @@ template <class V> struct ConvolutionState {
   // induced by all agents except j.
   std::vector<ConfigDistribution<V>> Pr;
 
+  // a distribution with a single configuration, of probability one
+  ConfigDistribution<V> pure;
+
+  // for AGG::getPayoffJacobianRow(): foreach i \in N, the projected mixed strat of i, or the
+  // pure strat of the player whose payoffs are computed; the distribution induced by all agents
+  // but i; and a temporary
+  std::vector<ConfigDistribution<V>> base, allBut;
+  ConfigDistribution<V> temp;
+
+  // for the symmetric and k-symmetric payoffs: the distribution over configurations, and that
+  // induced by one player class
+  ConfigDistribution<V> symDist, symTemp;
+
   ConvolutionState(int numActionNodes, int numPlayers)
     : projectedStrat(numActionNodes, std::vector<ConfigDistribution<V>>(numPlayers)),
-      Pr(numPlayers)
+      Pr(numPlayers), base(numPlayers), allBut(numPlayers)
   {
   }
 
@@ -93,7 +111,7 @@ template <class V> struct ConvolutionState {
     projectedStrat[Node][player].reset();
     for (int j = 0; j < numActions; j++) {
       if (s[j] > V(0)) {
-        projectedStrat[Node][player] += std::make_pair(contributions[j], s[j]);
+        projectedStrat[Node][player].add(contributions[j], s[j]);
       }
     }
   }
@@ -145,7 +163,7 @@ public:
   int lastKSymAction(int i) const { return kSymStrategyOffset[i + 1]; }
 
   // exp. payoff under mixed strat profile, via the convolution algorithm (doProjection/computeP,
-  // templated on V; inner_prod is trie_map's own method for V=double, exactInnerProd for
+  // templated on V; inner_prod is config_map's own method for V=double, exactInnerProd for
   // V=Rational -- see exactInnerProd's comment for why that one isn't merged too).
   template <class V> V getMixedPayoff(int player, const StrategyProfile<V> &s);
   void getPayoffVector(std::vector<double> &dest, int player, const StrategyProfile<double> &s);
@@ -306,13 +324,13 @@ private:
   // input functor
   struct input {
     input(std::istream &i, ExactPayoffTable &e) : in(i), exact(e) {}
-    void operator()(PayoffTable::iterator p)
+    void operator()(PayoffTable::key_type key, double &value)
     {
       std::string word;
       in >> word;
       const Number num(word);
-      p->second = static_cast<double>(num);
-      exact.insert(std::make_pair(p->first, num));
+      value = static_cast<double>(num);
+      exact.insert(std::make_pair(std::vector<int>(key.begin(), key.end()), num));
     }
     std::istream &in;
     ExactPayoffTable &exact;
@@ -363,12 +381,12 @@ private:
   template <class V> void doProjection(int Node, V *s);
   template <class V> void doProjection(int Node, int player, V *s);
 
-  // exactPayoffs is a std::map<..., Number>, not a trie_map<Rational>, so trie_map's own
+  // exactPayoffs is a std::map<..., Number>, not a config_map<Rational>, so config_map's own
   // inner_prod can't be used directly against it (unlike the double path, which calls
   // dist.inner_prod(payoffs[node]) directly) -- this does the equivalent sum manually.
   Rational exactInnerProd(int node, const ConfigDistribution<Rational> &dist) const;
 
-  // dispatch point used by getV/getJ: V=double calls trie_map's own inner_prod against
+  // dispatch point used by getV/getJ: V=double calls config_map's own inner_prod against
   // PayoffTable, V=Rational calls exactInnerProd against ExactPayoffTable. Not merged further
   // than this one function -- same reason PayoffTable/ExactPayoffTable themselves aren't a
   // template pair (see their comments): the two sides genuinely differ in container and value
@@ -3,8 +3,8 @@
 // Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
 //                          Albert Xin Jiang <albertjiang@gmail.com>
 //
-// FILE: src/games/agg/trie_map.cc
-// Trie with STL-like interfaces
+// FILE: src/games/agg/config_map.cc
+// Flat hash map from configurations to values
 //
 // This program is free software; you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -22,14 +22,11 @@
 //
 
 #include "agg.h"
-#include "trie_map.imp"
+#include "config_map.imp"
 
 namespace Gambit::agg {
 
-template class trie_map<double>;
-template std::ostream &operator<<(std::ostream &s, const trie_map<double> &t);
-
-template class trie_map<Rational>;
-template std::ostream &operator<<(std::ostream &s, const trie_map<Rational> &t);
+template class config_map<double>;
+template class config_map<Rational>;
 
 } // namespace Gambit::agg
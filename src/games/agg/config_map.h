@@ -0,0 +1,239 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//                          Albert Xin Jiang <albertjiang@gmail.com>
+//
+// FILE: src/games/agg/config_map.h
+// Flat hash map from configurations to values
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_GAMES_AGG_CONFIG_MAP_H
+#define GAMBIT_GAMES_AGG_CONFIG_MAP_H
+
+// Mapping from configurations (vectors of ints, all of the same length) to type V.
+//
+// Entries are stored contiguously, in order of insertion: the keys packed end to end in one
+// array, and the values in another.  They are indexed by an open-addressing hash table with
+// linear probing.  reset() empties the map but keeps its storage, so a map which is refilled
+// over and over -- as the distributions of the convolution algorithm are, on every payoff
+// evaluation -- stops allocating once it has reached its largest size.
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "proj_func.h"
+
+namespace Gambit::agg {
+
+template <class V> class config_map {
+  template <bool Const> class basic_iterator;
+
+public:
+  using key_type = std::span<const int>;
+  using mapped_type = V;
+  using size_type = size_t;
+
+  // An entry, as seen through an iterator: its key, and a reference to its value
+  template <bool Const> struct basic_entry {
+    std::span<const int> first;
+    std::conditional_t<Const, const V &, V &> second;
+  };
+
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  config_map() = default;
+  config_map(const config_map<V> &) = default;
+  config_map(config_map<V> &&) noexcept = default;
+  ~config_map() = default;
+
+  // Assignment keeps the storage of this map where it is large enough
+  config_map<V> &operator=(const config_map<V> &other);
+  config_map<V> &operator=(config_map<V> &&) noexcept = default;
+
+  size_type size() const { return m_values.size(); }
+  bool empty() const { return m_values.empty(); }
+  iterator begin() { return {this, 0}; }
+  iterator end() { return {this, size()}; }
+  const_iterator begin() const { return {this, 0}; }
+  const_iterator end() const { return {this, size()}; }
+
+  // insert: as in std::map, returns the entry with the key, and whether it was inserted
+  std::pair<iterator, bool> insert(key_type key, const V &value);
+
+  template <class InputIterator> void insert(InputIterator f, InputIterator l)
+  {
+    for (InputIterator p = f; p != l; ++p) {
+      insert((*p).first, (*p).second);
+    }
+  }
+
+  // insert or add
+  void add(key_type key, const V &value);
+
+  iterator find(key_type key) { return {this, lookup(key, hash(key))}; }
+  const_iterator find(key_type key) const { return {this, lookup(key, hash(key))}; }
+
+  // number of elements with key exactly k: returns 1 or 0
+  size_type count(key_type key) const { return lookup(key, hash(key)) != size(); }
+
+  // remove all entries, keeping the storage for reuse
+  void reset();
+
+  // remove all entries, and release the storage
+  void clear() { *this = config_map<V>(); }
+
+  // visits the entries in lexicographic order of their keys, calling f(key, value)
+  template <class BinaryFunction> void in_order(BinaryFunction f)
+  {
+    std::vector<size_t> order(size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+      const auto ka = key(a), kb = key(b);
+      return std::lexicographical_compare(ka.begin(), ka.end(), kb.begin(), kb.end());
+    });
+    for (const size_t index : order) {
+      f(key(index), m_values[index]);
+    }
+  }
+
+  // polynomial multiplication of t1 and t2, store the result in self
+  void multiply(const config_map<V> &t1, const config_map<V> &t2, size_t keylen,
+                const std::vector<projtype> &f);
+
+  // multiply in-place. other should not be the same object as self.
+  void multiply(const config_map<V> &other, size_t keylen, const std::vector<projtype> &f);
+
+  // squaring
+  void square(config_map<V> &dest, size_t keylen, const std::vector<projtype> &f) const;
+
+  // squaring in-place
+  void square(size_t keylen, const std::vector<projtype> &f);
+
+  void power(size_t p, config_map<V> &dest, config_map<V> &scratch, size_t keylen,
+             const std::vector<projtype> &f) const;
+
+  // inner product
+  V inner_prod(const config_map<V> &other, V init = (V)(0)) const;
+
+  // first apply the action x, then inner prod
+  V inner_prod(const std::vector<int> &x, size_t keylen, const std::vector<projtype> &f,
+               const config_map<V> &other, V init = (V)(0)) const;
+
+private:
+  static constexpr double THRESH = 1e-12;
+  static constexpr size_t MIN_SLOTS = 16;
+
+  size_t m_keylen{0};
+  // entry i has key m_keys[i * m_keylen, (i + 1) * m_keylen), value m_values[i] and hash
+  // m_hashes[i]
+  std::vector<int> m_keys;
+  std::vector<V> m_values;
+  std::vector<size_t> m_hashes;
+  // the hash table: the index of an entry plus one, or zero for an empty slot
+  std::vector<uint32_t> m_slots;
+  // the previous contents, while a map is multiplied or squared in place
+  std::vector<int> m_oldKeys;
+  std::vector<V> m_oldValues;
+  // the key being computed by multiply() or square()
+  std::vector<int> m_key;
+
+  std::span<const int> key(size_t index) const
+  {
+    return {m_keys.data() + index * m_keylen, m_keylen};
+  }
+  static size_t hash(key_type key)
+  {
+    // FNV-1a, taking each component as a unit
+    size_t h = 14695981039346656037ULL;
+    for (const int k : key) {
+      h = (h ^ static_cast<size_t>(static_cast<unsigned int>(k))) * 1099511628211ULL;
+    }
+    return h;
+  }
+  size_t slot(size_t h) const { return (h ^ (h >> 32)) & (m_slots.size() - 1); }
+  // the index of the entry with the key, or size() if there is none
+  size_t lookup(key_type key, size_t h) const;
+  // adds an entry with a key known not to be present, and returns its index
+  size_t append(key_type key, size_t h, const V &value);
+  void rehash(size_t numSlots);
+  // the product of the configurations p and q, in m_key
+  void combine(std::span<const int> p, std::span<const int> q, size_t keylen,
+               const std::vector<projtype> &f)
+  {
+    m_key.resize(keylen);
+    for (size_t i = 0; i < keylen; ++i) {
+      m_key[i] = (*(f[i]))(p[i], q[i]);
+    }
+  }
+  // store in self the product of the entries (keys, values), whose keys have length
+  // oldKeylen, with other, or their square
+  void multiplyFrom(const std::vector<int> &keys, const std::vector<V> &values, size_t oldKeylen,
+                    const config_map<V> &other, size_t keylen, const std::vector<projtype> &f);
+  void squareFrom(const std::vector<int> &keys, const std::vector<V> &values, size_t oldKeylen,
+                  size_t keylen, const std::vector<projtype> &f);
+  [[noreturn]] static void discard(std::span<const int> key, const V &value);
+};
+
+template <class V> template <bool Const> class config_map<V>::basic_iterator {
+  using map_type = std::conditional_t<Const, const config_map<V>, config_map<V>>;
+
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = basic_entry<Const>;
+  using reference = basic_entry<Const>;
+
+  // the entry pointed to, held by value, for operator->
+  struct pointer {
+    basic_entry<Const> entry;
+    const basic_entry<Const> *operator->() const { return &entry; }
+  };
+
+  basic_iterator() = default;
+  basic_iterator(map_type *p_map, size_t p_index) : m_map(p_map), m_index(p_index) {}
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  operator basic_iterator<true>() const { return {m_map, m_index}; }
+
+  reference operator*() const { return {m_map->key(m_index), m_map->m_values[m_index]}; }
+  pointer operator->() const { return {**this}; }
+  basic_iterator &operator++()
+  {
+    ++m_index;
+    return *this;
+  }
+  basic_iterator operator++(int)
+  {
+    basic_iterator copy = *this;
+    ++m_index;
+    return copy;
+  }
+  bool operator==(const basic_iterator &other) const { return m_index == other.m_index; }
+  bool operator!=(const basic_iterator &other) const { return m_index != other.m_index; }
+
+private:
+  map_type *m_map{nullptr};
+  size_t m_index{0};
+};
+
+} // end namespace Gambit::agg
+
+#endif // GAMBIT_GAMES_AGG_CONFIG_MAP_H
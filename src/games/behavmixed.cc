@@ -44,6 +44,7 @@ MixedBehaviorProfile<T>::MixedBehaviorProfile(const Game &p_game)
       m_profileIndex[action] = index++;
     }
   }
+  IndexCache();
   SetCentroid();
 }
 
@@ -64,6 +65,7 @@ MixedBehaviorProfile<T>::MixedBehaviorProfile(const BehaviorSupportProfile &p_su
       }
     }
   }
+  IndexCache();
   SetCentroid();
 }
 
@@ -136,6 +138,7 @@ MixedBehaviorProfile<T>::MixedBehaviorProfile(const MixedStrategyProfile<T> &p_p
       m_probs[index++] = static_cast<T>(0);
     }
   }
+  IndexCache();
 
   GameNodeRep *root = m_support.GetGame()->GetRoot().get();
 
@@ -170,6 +173,7 @@ MixedBehaviorProfile<T>::MixedBehaviorProfile(const MixedSequenceProfile<T> &p_p
       m_profileIndex[action] = index++;
     }
   }
+  IndexCache();
   for (auto player : game->GetPlayers()) {
     for (auto sequence : player->GetSequences()) {
       if (!sequence->GetAction()) {
@@ -292,7 +296,8 @@ template <class T> T MixedBehaviorProfile<T>::GetAgentLiapValue() const
       continue;
     }
     for (auto action : m_support.GetActions(infoset)) {
-      value += sqr(std::max(m_cache.m_actionValues[action] - m_cache.m_infosetValues[infoset],
+      value += sqr(std::max(m_cache.m_actionValues[ActionIndex(action)] -
+                                m_cache.m_infosetValues[InfosetIndex(infoset)],
                             static_cast<T>(0)));
     }
   }
@@ -303,14 +308,14 @@ template <class T> const T &MixedBehaviorProfile<T>::GetRealizProb(const GameNod
 {
   CheckVersion();
   EnsureRealizations();
-  return m_cache.m_realizProbs[node];
+  return m_cache.m_realizProbs[NodeIndex(node)];
 }
 
 template <class T> T MixedBehaviorProfile<T>::GetInfosetProb(const GameInfoset &p_infoset) const
 {
   CheckVersion();
   EnsureRealizations();
-  return m_cache.m_infosetProbs[p_infoset];
+  return m_cache.m_infosetProbs[InfosetIndex(p_infoset)];
 }
 
 template <class T>
@@ -321,7 +326,7 @@ std::optional<T> MixedBehaviorProfile<T>::GetBeliefProb(const GameNode &node) co
   if (!node->GetInfoset() || GetInfosetProb(node->GetInfoset()) == T{0}) {
     return std::nullopt;
   }
-  return m_cache.m_beliefs[node];
+  return m_cache.m_beliefs[NodeIndex(node)];
 }
 
 template <class T> Vector<T> MixedBehaviorProfile<T>::GetPayoff(const GameNode &node) const
@@ -331,7 +336,7 @@ template <class T> Vector<T> MixedBehaviorProfile<T>::GetPayoff(const GameNode &
   Vector<T> ret(node->GetGame()->NumPlayers());
   auto players = node->GetGame()->GetPlayers();
   std::transform(players.begin(), players.end(), ret.begin(),
-                 [this, node](GamePlayer player) { return m_cache.m_nodeValues[node][player]; });
+                 [this, node](GamePlayer player) { return NodeValue(node, player); });
   return ret;
 }
 
@@ -341,7 +346,7 @@ const T &MixedBehaviorProfile<T>::GetPayoff(const GamePlayer &p_player,
 {
   CheckVersion();
   EnsureNodeValues();
-  return m_cache.m_nodeValues.at(p_node).at(p_player);
+  return NodeValue(p_node, p_player);
 }
 
 template <class T>
@@ -352,7 +357,7 @@ std::optional<T> MixedBehaviorProfile<T>::GetPayoff(const GameInfoset &p_infoset
   if (GetInfosetProb(p_infoset) == T{0}) {
     return std::nullopt;
   }
-  return m_cache.m_infosetValues[p_infoset];
+  return m_cache.m_infosetValues[InfosetIndex(p_infoset)];
 }
 
 template <class T> T MixedBehaviorProfile<T>::GetActionProb(const GameAction &action) const
@@ -374,7 +379,7 @@ template <class T> std::optional<T> MixedBehaviorProfile<T>::GetPayoff(const Gam
   if (GetInfosetProb(act->GetInfoset()) == T{0}) {
     return std::nullopt;
   }
-  return m_cache.m_actionValues[act];
+  return m_cache.m_actionValues[ActionIndex(act)];
 }
 
 template <class T> T MixedBehaviorProfile<T>::GetRegret(const GameAction &act) const
@@ -384,7 +389,7 @@ template <class T> T MixedBehaviorProfile<T>::GetRegret(const GameAction &act) c
   if (GetInfosetProb(act->GetInfoset()) == T{0}) {
     return T{0};
   }
-  return m_cache.m_regret.at(act);
+  return m_cache.m_regret[ActionIndex(act)];
 }
 
 template <class T> T MixedBehaviorProfile<T>::GetRegret(const GameInfoset &p_infoset) const
@@ -395,9 +400,9 @@ template <class T> T MixedBehaviorProfile<T>::GetRegret(const GameInfoset &p_inf
     return T{0};
   }
   T br_payoff = maximize_function(p_infoset->GetActions(), [this](const auto &action) -> T {
-    return m_cache.m_actionValues.at(action);
+    return m_cache.m_actionValues[ActionIndex(action)];
   });
-  return br_payoff - m_cache.m_infosetValues[p_infoset];
+  return br_payoff - m_cache.m_infosetValues[InfosetIndex(p_infoset)];
 }
 
 template <class T> T MixedBehaviorProfile<T>::GetMaxRegret() const
@@ -439,8 +444,8 @@ T MixedBehaviorProfile<T>::DiffActionValue(const GameAction &p_action,
     const GameNode child = member->GetChild(p_action);
 
     deriv += DiffRealizProb(member, p_oppAction) *
-             (m_cache.m_nodeValues[child][player] - m_cache.m_actionValues[p_action]);
-    deriv += m_cache.m_realizProbs[member] *
+             (NodeValue(child, player) - m_cache.m_actionValues[ActionIndex(p_action)]);
+    deriv += m_cache.m_realizProbs[NodeIndex(member)] *
              DiffNodeValue(member->GetChild(p_action), player, p_oppAction);
   }
 
@@ -485,7 +490,7 @@ T MixedBehaviorProfile<T>::DiffNodeValue(const GameNode &p_node, const GamePlaye
     // We've encountered the action; since we assume perfect recall,
     // we won't encounter it again, and the downtree value must
     // be the same.
-    return m_cache.m_nodeValues[p_node->GetChild(p_oppAction)][p_player];
+    return NodeValue(p_node->GetChild(p_oppAction), p_player);
   }
   return sum_function(p_node->GetActions(), [&](auto action_child) -> T {
     return DiffNodeValue(action_child.second, p_player, p_oppAction) *
@@ -497,47 +502,64 @@ T MixedBehaviorProfile<T>::DiffNodeValue(const GameNode &p_node, const GamePlaye
 //             MixedBehaviorProfile<T>: Cached profile information
 //========================================================================
 
-template <class T> void MixedBehaviorProfile<T>::ComputeRealizationProbs() const
+template <class T> void MixedBehaviorProfile<T>::IndexCache()
 {
-  m_cache.m_realizProbs.clear();
-  m_cache.m_infosetProbs.clear();
+  const auto &game = m_support.GetGame();
+  game->EnsureInfosetOrdering();
+  m_numPlayers = game->NumPlayers();
+  m_infosetOffsets.assign(m_numPlayers + 1, 0);
+  m_actionOffsets.assign(1, 0);
+  for (const auto &player : game->GetPlayersWithChance()) {
+    m_infosetOffsets[player->GetNumber()] = m_actionOffsets.size() - 1;
+    for (const auto &infoset : player->GetInfosets()) {
+      m_actionOffsets.push_back(m_actionOffsets.back() + infoset->GetActions().size());
+    }
+  }
+}
 
+template <class T> void MixedBehaviorProfile<T>::ComputeRealizationProbs() const
+{
   const auto &game = m_support.GetGame();
-  m_cache.m_realizProbs[game->GetRoot()] = static_cast<T>(1);
+  game->EnsureInfosetOrdering();
+  m_cache.m_realizProbs.resize(game->NumNodes());
+  m_cache.m_infosetProbs.resize(m_actionOffsets.size() - 1);
+
+  m_cache.m_realizProbs[NodeIndex(game->GetRoot())] = static_cast<T>(1);
   for (const auto &node : game->GetNodes()) {
-    const T incomingProb = m_cache.m_realizProbs[node];
+    const T incomingProb = m_cache.m_realizProbs[NodeIndex(node)];
     for (auto [action, child] : node->GetActions()) {
-      m_cache.m_realizProbs[child] = incomingProb * GetActionProb(action);
+      m_cache.m_realizProbs[NodeIndex(child)] = incomingProb * GetActionProb(action);
     }
   }
 
   for (const auto &player : game->GetPlayersWithChance()) {
     for (const auto &infoset : player->GetInfosets()) {
-      m_cache.m_infosetProbs[infoset] =
-          sum_function(infoset->GetMembers(),
-                       [&](const auto &node) -> T { return m_cache.m_realizProbs[node]; });
+      m_cache.m_infosetProbs[InfosetIndex(infoset)] =
+          sum_function(infoset->GetMembers(), [&](const auto &node) -> T {
+            return m_cache.m_realizProbs[NodeIndex(node)];
+          });
     }
   }
   for (const auto &[infoset, node] : game->GetAbsentMindedReentries()) {
-    m_cache.m_infosetProbs[infoset] -= m_cache.m_realizProbs[node];
+    m_cache.m_infosetProbs[InfosetIndex(infoset)] -= m_cache.m_realizProbs[NodeIndex(node)];
   }
 }
 
 template <class T> void MixedBehaviorProfile<T>::ComputeBeliefs() const
 {
-  m_cache.m_beliefs.clear();
+  m_cache.m_beliefs.assign(m_cache.m_realizProbs.size(), T{0});
   // Normalise each member's realization probability by the infoset's upper-frontier probability
   // (m_infosetProbs, computed in ComputeRealizationProbs), following Halpern and Pass (2021).
   // For an absent-minded infoset the frontier excludes the reentry members, so the member beliefs
   // may sum to above 1; for a non-absent-minded infoset the frontier is all members and this is
   // the standard Selten (1975) normalization.
   for (const auto &infoset : m_support.GetGame()->GetInfosets()) {
-    const T infosetProb = m_cache.m_infosetProbs[infoset];
+    const T infosetProb = m_cache.m_infosetProbs[InfosetIndex(infoset)];
     if (infosetProb == static_cast<T>(0)) {
       continue;
     }
     for (const auto &node : infoset->GetMembers()) {
-      m_cache.m_beliefs[node] = m_cache.m_realizProbs[node] / infosetProb;
+      m_cache.m_beliefs[NodeIndex(node)] = m_cache.m_realizProbs[NodeIndex(node)] / infosetProb;
     }
   }
 }
@@ -545,23 +567,21 @@ template <class T> void MixedBehaviorProfile<T>::ComputeBeliefs() const
 template <class T> void MixedBehaviorProfile<T>::ComputeNodeValues() const
 {
   const auto &game = m_support.GetGame();
-  m_cache.m_nodeValues.clear();
+  m_cache.m_nodeValues.assign(game->NumNodes() * m_numPlayers, T{0});
 
   for (const auto &node : game->GetNodes(TraversalOrder::Postorder)) {
-    auto &vals = m_cache.m_nodeValues[node];
-    for (const auto &player : game->GetPlayers()) {
-      vals[player] = static_cast<T>(0);
-    }
+    T *vals = m_cache.m_nodeValues.data() + NodeIndex(node) * m_numPlayers;
     if (node->GetOutcome()) {
       const GameOutcome &outcome = node->GetOutcome();
       for (const auto &player : game->GetPlayers()) {
-        vals[player] += outcome->GetPayoff<T>(player);
+        vals[player->GetNumber() - 1] += outcome->GetPayoff<T>(player);
       }
     }
     for (auto [action, child] : node->GetActions()) {
       const T p = GetActionProb(action);
-      for (const auto &player : game->GetPlayers()) {
-        vals[player] += p * m_cache.m_nodeValues[child][player];
+      const T *childVals = m_cache.m_nodeValues.data() + NodeIndex(child) * m_numPlayers;
+      for (size_t pl = 0; pl < m_numPlayers; ++pl) {
+        vals[pl] += p * childVals[pl];
       }
     }
   }
@@ -570,17 +590,17 @@ template <class T> void MixedBehaviorProfile<T>::ComputeNodeValues() const
 template <class T> void MixedBehaviorProfile<T>::ComputeActionValues() const
 {
   const auto &game = m_support.GetGame();
-  m_cache.m_actionValues.clear();
+  m_cache.m_actionValues.assign(m_actionOffsets.back(), T{0});
 
   for (const auto &infoset : game->GetInfosets()) {
     const auto &player = infoset->GetPlayer();
     for (const auto &node : infoset->GetMembers()) {
-      T belief = m_cache.m_beliefs[node];
+      const T &belief = m_cache.m_beliefs[NodeIndex(node)];
       if (belief == static_cast<T>(0)) {
         continue;
       }
       for (auto [action, child] : node->GetActions()) {
-        m_cache.m_actionValues[action] += belief * m_cache.m_nodeValues[child][player];
+        m_cache.m_actionValues[ActionIndex(action)] += belief * NodeValue(child, player);
       }
     }
   }
@@ -588,19 +608,20 @@ template <class T> void MixedBehaviorProfile<T>::ComputeActionValues() const
 
 template <class T> void MixedBehaviorProfile<T>::ComputeActionRegrets() const
 {
+  m_cache.m_infosetValues.assign(m_actionOffsets.size() - 1, T{0});
+  m_cache.m_regret.assign(m_cache.m_actionValues.size(), T{0});
   for (const auto &infoset : m_support.GetGame()->GetInfosets()) {
-    m_cache.m_infosetValues[infoset] =
+    m_cache.m_infosetValues[InfosetIndex(infoset)] =
         sum_function(infoset->GetActions(), [&](const auto &action) -> T {
-          return GetActionProb(action) * m_cache.m_actionValues[action];
+          return GetActionProb(action) * m_cache.m_actionValues[ActionIndex(action)];
         });
 
-    auto actions = infoset->GetActions();
     const T brpayoff = maximize_function(infoset->GetActions(), [&](const auto &action) -> T {
-      return m_cache.m_actionValues[action];
+      return m_cache.m_actionValues[ActionIndex(action)];
     });
     for (const auto &action : infoset->GetActions()) {
-      m_cache.m_regret[action] =
-          std::max(brpayoff - m_cache.m_actionValues[action], static_cast<T>(0));
+      m_cache.m_regret[ActionIndex(action)] =
+          std::max(brpayoff - m_cache.m_actionValues[ActionIndex(action)], static_cast<T>(0));
     }
   }
 }
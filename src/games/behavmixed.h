@@ -44,39 +44,64 @@ protected:
   std::map<GameAction, int> m_profileIndex;
   unsigned int m_gameversion;
 
+  /// @name Indexing of cached values
+  ///
+  /// Cached values are stored in vectors, addressed by the numbering of nodes,
+  /// information sets and actions which the game maintains.  Information sets and
+  /// actions are numbered within their player and information set, respectively;
+  /// these give the offsets of each player's information sets and of each information
+  /// set's actions, with the total number of actions as a final entry.
+  //@{
+  std::vector<size_t> m_infosetOffsets, m_actionOffsets;
+  size_t m_numPlayers{0};
+  //@}
+
   struct Cache {
     enum class Level { None, Realizations, Beliefs, NodeValues, ActionValues, Regrets };
 
     Level m_level{Level::None};
-    std::map<GameNode, T> m_realizProbs, m_beliefs;
-    std::map<GameInfoset, T> m_infosetProbs;
-    std::map<GameNode, std::map<GamePlayer, T>> m_nodeValues;
-    std::map<GameInfoset, T> m_infosetValues;
-    std::map<GameAction, T> m_actionValues;
-    std::map<GameAction, T> m_regret;
+    /// Indexed by node
+    std::vector<T> m_realizProbs, m_beliefs;
+    /// Indexed by information set
+    std::vector<T> m_infosetProbs, m_infosetValues;
+    /// Indexed by node and player, with players varying fastest
+    std::vector<T> m_nodeValues;
+    /// Indexed by action
+    std::vector<T> m_actionValues, m_regret;
 
     Cache() = default;
     Cache(const Cache &) = default;
     Cache &operator=(const Cache &) = default;
     ~Cache() = default;
 
-    void Clear()
-    {
-      m_level = Level::None;
-      m_realizProbs.clear();
-      m_infosetProbs.clear();
-      m_beliefs.clear();
-      m_nodeValues.clear();
-      m_infosetValues.clear();
-      m_actionValues.clear();
-      m_regret.clear();
-    }
+    /// Marks all values as out of date.  The storage is kept, to be reused when the
+    /// values are next computed.
+    void Clear() { m_level = Level::None; }
   };
 
   mutable Cache m_cache;
 
   /// @name Auxiliary functions for cached computation of interesting values
   //@{
+  /// Compute the offsets used to index cached values
+  void IndexCache();
+  /// Positions of the cached values for game elements
+  static size_t NodeIndex(const GameNode &p_node) { return p_node.get()->m_number - 1; }
+  size_t InfosetIndex(const GameInfosetRep *p_infoset) const
+  {
+    return m_infosetOffsets[p_infoset->m_player->m_number] + p_infoset->m_number - 1;
+  }
+  size_t InfosetIndex(const GameInfoset &p_infoset) const { return InfosetIndex(p_infoset.get()); }
+  size_t ActionIndex(const GameAction &p_action) const
+  {
+    const GameActionRep *action = p_action.get();
+    return m_actionOffsets[InfosetIndex(action->m_infoset)] + action->m_number - 1;
+  }
+  T &NodeValue(const GameNode &p_node, const GamePlayer &p_player) const
+  {
+    return m_cache.m_nodeValues[NodeIndex(p_node) * m_numPlayers + p_player.get()->m_number - 1];
+  }
+
   /// Compute the realization probabilities of all nodes, and of information sets
   /// (the probability a given information set is reached at least once)
   void ComputeRealizationProbs() const;
@@ -237,7 +262,7 @@ public:
   {
     CheckVersion();
     EnsureNodeValues();
-    return m_cache.m_nodeValues[m_support.GetGame()->GetRoot()][p_player];
+    return NodeValue(m_support.GetGame()->GetRoot(), p_player);
   }
   T GetLiapValue() const;
   T GetAgentLiapValue() const;
@@ -0,0 +1,567 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/games/binary.cc
+// Reading and writing games in Gambit's binary format
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+// The binary format holds the same information as the .efg and .nfg formats, but
+// lays out the numerical data of a game in flat blocks, so large games may be saved
+// and loaded without formatting and parsing each number as text.
+//
+// All integers are unsigned and little-endian, and doubles are stored as the bits of
+// their IEEE 754 representation, so files may be exchanged between platforms.  A
+// string is a 64-bit length followed by that many bytes of UTF-8 text.
+//
+// A file begins with the signature, then a 32-bit format version (currently 1), a
+// 32-bit kind of game (1 for a table, 2 for a tree), and the title, description and
+// player labels (a 32-bit count, then the strings).  For a table there follow the
+// strategy labels of each player in turn (a 32-bit count, then the strings).
+//
+// Then come the outcomes: a 64-bit count, their labels, and for each player in turn a
+// block of the payoffs to the player at each outcome.  A block of numbers is a byte
+// giving its representation, then the numbers: 64-bit integers (1), doubles (2), or
+// strings in any of the forms accepted in .efg and .nfg files (3).  Integers and
+// doubles are used when all the numbers of a block can be written so; a number read
+// from a double has the shortest decimal representation which reads back as it.
+//
+// For a table there follows the outcome at each pure strategy profile, in the order in
+// which the profiles are listed in the .nfg formats: a byte which is 0 if the outcome at
+// the k-th profile is outcome k, for each profile, or otherwise 1 followed by a 64-bit
+// count and the number of the outcome at each profile, or 0 for none.
+//
+// For a tree there follow the information sets, in the order in which they are first
+// reached in a preorder traversal of the tree: a 64-bit count, then for each the
+// 32-bit number of its player (0 for chance), its label, its action labels (a 32-bit
+// count, then the strings), and for a chance information set a block of the action
+// probabilities.  Then come the nodes, in preorder: a 64-bit count, then the 64-bit
+// index of the parent of each (numbering the nodes from 1, with 0 for the root), the
+// 64-bit index of its information set (from 1, or 0 for a terminal node), the 64-bit
+// number of its outcome (0 for none), and its label.
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+
+#include "games.h"
+#include "gametable.h"
+#include "gametree.h"
+
+namespace Gambit {
+
+namespace {
+
+/// The first bytes of a file in the binary format.  As in PNG, the first byte is not
+/// ASCII, and the line endings reveal a file which has been translated as text.
+constexpr std::string_view BinarySignature("\x89GBG\r\n\x1a\n", 8);
+constexpr std::uint32_t BinaryVersion = 1;
+
+enum class BinaryGameKind : std::uint32_t { Table = 1, Tree = 2 };
+enum class BinaryNumbers : std::uint8_t { Integer = 1, Double = 2, Text = 3 };
+enum class BinaryOutcomeMap : std::uint8_t { Identity = 0, Explicit = 1 };
+
+/// Returns the value of p_number as a 64-bit integer, if its text is the usual
+/// representation of one, so that the number read back from the integer is the same
+std::optional<std::int64_t> AsInteger(const Number &p_number)
+{
+  const auto &text = static_cast<const std::string &>(p_number);
+  std::int64_t value;
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+  if (error != std::errc() || end != text.data() + text.size() ||
+      std::to_string(value) != text) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+/// Returns true if p_number has the text of a number read from its double value
+bool IsDecimalDouble(const Number &p_number)
+{
+  const auto value = static_cast<const double &>(p_number);
+  return std::isfinite(value) &&
+         static_cast<const std::string &>(p_number) == DecimalText(value);
+}
+
+class BinaryWriter {
+public:
+  explicit BinaryWriter(std::ostream &p_stream) : m_stream(p_stream) {}
+  ~BinaryWriter() = default;
+
+  void WriteBytes(std::string_view p_bytes)
+  {
+    m_buffer.append(p_bytes);
+    if (m_buffer.size() >= BufferSize) {
+      Flush();
+    }
+  }
+  template <class T> void WriteUnsigned(T p_value)
+  {
+    char bytes[sizeof(T)];
+    for (auto &byte : bytes) {
+      byte = static_cast<char>(p_value & 0xff);
+      p_value >>= 8;
+    }
+    WriteBytes(std::string_view(bytes, sizeof(T)));
+  }
+  void WriteString(const std::string &p_text)
+  {
+    WriteUnsigned<std::uint64_t>(p_text.size());
+    WriteBytes(p_text);
+  }
+  template <class Container> void WriteStrings(const Container &p_labels)
+  {
+    WriteUnsigned<std::uint32_t>(p_labels.size());
+    for (const auto &label : p_labels) {
+      WriteString(label);
+    }
+  }
+  /// Writes the block of p_count numbers p_number(0), ..., p_number(p_count - 1), in the
+  /// most compact representation which holds them all exactly
+  template <class Getter> void WriteNumbers(size_t p_count, Getter p_number)
+  {
+    const auto all = [&](auto p_test) {
+      for (size_t i = 0; i < p_count; ++i) {
+        if (!p_test(p_number(i))) {
+          return false;
+        }
+      }
+      return true;
+    };
+    auto kind = BinaryNumbers::Text;
+    if (all([](const Number &n) { return AsInteger(n).has_value(); })) {
+      kind = BinaryNumbers::Integer;
+    }
+    else if (all(IsDecimalDouble)) {
+      kind = BinaryNumbers::Double;
+    }
+    WriteUnsigned(static_cast<std::uint8_t>(kind));
+    for (size_t i = 0; i < p_count; ++i) {
+      const Number &number = p_number(i);
+      switch (kind) {
+      case BinaryNumbers::Integer:
+        WriteUnsigned(static_cast<std::uint64_t>(*AsInteger(number)));
+        break;
+      case BinaryNumbers::Double:
+        WriteUnsigned(std::bit_cast<std::uint64_t>(static_cast<const double &>(number)));
+        break;
+      case BinaryNumbers::Text:
+        WriteString(static_cast<const std::string &>(number));
+        break;
+      }
+    }
+  }
+  void Flush()
+  {
+    m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
+  }
+
+private:
+  static constexpr size_t BufferSize = 1 << 20;
+  std::ostream &m_stream;
+  std::string m_buffer;
+};
+
+class BinaryReader {
+public:
+  explicit BinaryReader(std::string_view p_data) : m_data(p_data) {}
+
+  std::string_view ReadBytes(size_t p_count)
+  {
+    if (p_count > m_data.size() - m_pos) {
+      throw InvalidFileException("Unexpected end of binary game file");
+    }
+    const auto bytes = m_data.substr(m_pos, p_count);
+    m_pos += p_count;
+    return bytes;
+  }
+  template <class T> T ReadUnsigned()
+  {
+    const auto bytes = ReadBytes(sizeof(T));
+    T value = 0;
+    for (size_t i = sizeof(T); i-- > 0;) {
+      value = static_cast<T>((value << 8) | static_cast<unsigned char>(bytes[i]));
+    }
+    return value;
+  }
+  /// Reads a count of items, each of which takes at least p_minSize bytes, so that
+  /// a corrupted count is found out before space is allocated for the items
+  template <class T> size_t ReadCount(size_t p_minSize)
+  {
+    const auto count = ReadUnsigned<T>();
+    if (count > (m_data.size() - m_pos) / std::max<size_t>(p_minSize, 1)) {
+      throw InvalidFileException("Unexpected end of binary game file");
+    }
+    return static_cast<size_t>(count);
+  }
+  std::string ReadString() { return std::string(ReadBytes(ReadCount<std::uint64_t>(1))); }
+  std::vector<std::string> ReadStrings()
+  {
+    std::vector<std::string> labels(ReadCount<std::uint32_t>(sizeof(std::uint64_t)));
+    for (auto &label : labels) {
+      label = ReadString();
+    }
+    return labels;
+  }
+  std::vector<Number> ReadNumbers(size_t p_count)
+  {
+    const auto kind = static_cast<BinaryNumbers>(ReadUnsigned<std::uint8_t>());
+    if (kind != BinaryNumbers::Integer && kind != BinaryNumbers::Double &&
+        kind != BinaryNumbers::Text) {
+      throw InvalidFileException("Unknown representation of numbers in binary game file");
+    }
+    if (p_count > (m_data.size() - m_pos) / sizeof(std::uint64_t)) {
+      throw InvalidFileException("Unexpected end of binary game file");
+    }
+    std::vector<Number> numbers;
+    numbers.reserve(p_count);
+    for (size_t i = 0; i < p_count; ++i) {
+      switch (kind) {
+      case BinaryNumbers::Integer:
+        numbers.emplace_back(
+            std::to_string(static_cast<std::int64_t>(ReadUnsigned<std::uint64_t>())));
+        break;
+      case BinaryNumbers::Double: {
+        const auto value = std::bit_cast<double>(ReadUnsigned<std::uint64_t>());
+        if (!std::isfinite(value)) {
+          throw InvalidFileException("Numbers in binary game file must be finite");
+        }
+        numbers.emplace_back(DecimalText(value));
+        break;
+      }
+      case BinaryNumbers::Text:
+        numbers.emplace_back(ReadString());
+        break;
+      }
+    }
+    return numbers;
+  }
+  bool AtEnd() const { return m_pos == m_data.size(); }
+
+private:
+  std::string_view m_data;
+  size_t m_pos{0};
+};
+
+//------------------------------------------------------------------------
+//                          Writing binary files
+//------------------------------------------------------------------------
+
+void WriteOutcomes(BinaryWriter &p_writer, const Game &p_game)
+{
+  const auto outcomes = p_game->GetOutcomes();
+  const std::vector<GameOutcome> list(outcomes.begin(), outcomes.end());
+  p_writer.WriteUnsigned<std::uint64_t>(list.size());
+  for (const auto &outcome : list) {
+    p_writer.WriteString(outcome->GetLabel());
+  }
+  for (const auto &player : p_game->GetPlayers()) {
+    p_writer.WriteNumbers(list.size(), [&](size_t i) -> const Number & {
+      return list[i]->GetPayoff<Number>(player);
+    });
+  }
+}
+
+void WriteTable(BinaryWriter &p_writer, const Game &p_game)
+{
+  for (const auto &player : p_game->GetPlayers()) {
+    std::vector<std::string> labels;
+    for (const auto &strategy : player->GetStrategies()) {
+      labels.push_back(strategy->GetLabel());
+    }
+    p_writer.WriteStrings(labels);
+  }
+  WriteOutcomes(p_writer, p_game);
+
+  const auto indices = dynamic_cast<const GameTableRep &>(*p_game).GetOutcomeIndices();
+  bool identity = (indices.size() == p_game->GetOutcomes().size());
+  for (size_t i = 0; identity && i < indices.size(); ++i) {
+    identity = (indices[i] == i + 1);
+  }
+  if (identity) {
+    p_writer.WriteUnsigned(static_cast<std::uint8_t>(BinaryOutcomeMap::Identity));
+    return;
+  }
+  p_writer.WriteUnsigned(static_cast<std::uint8_t>(BinaryOutcomeMap::Explicit));
+  p_writer.WriteUnsigned<std::uint64_t>(indices.size());
+  for (const auto index : indices) {
+    p_writer.WriteUnsigned<std::uint64_t>(index);
+  }
+}
+
+void WriteTree(BinaryWriter &p_writer, const Game &p_game)
+{
+  WriteOutcomes(p_writer, p_game);
+
+  std::vector<GameNode> nodes;
+  std::unordered_map<const GameNodeRep *, size_t> nodeIndex;
+  std::vector<GameInfoset> infosets;
+  std::unordered_map<const GameInfosetRep *, size_t> infosetIndex;
+  for (const auto &node : p_game->GetNodes()) {
+    nodeIndex[node.get()] = nodes.size() + 1;
+    nodes.push_back(node);
+    if (const auto infoset = node->GetInfoset();
+        infoset && infosetIndex.emplace(infoset.get(), infosets.size() + 1).second) {
+      infosets.push_back(infoset);
+    }
+  }
+
+  p_writer.WriteUnsigned<std::uint64_t>(infosets.size());
+  for (const auto &infoset : infosets) {
+    const bool chance = infoset->IsChanceInfoset();
+    p_writer.WriteUnsigned<std::uint32_t>((chance) ? 0 : infoset->GetPlayer()->GetNumber());
+    p_writer.WriteString(infoset->GetLabel());
+    const auto actions = infoset->GetActions();
+    const std::vector<GameAction> list(actions.begin(), actions.end());
+    std::vector<std::string> labels;
+    for (const auto &action : list) {
+      labels.push_back(action->GetLabel());
+    }
+    p_writer.WriteStrings(labels);
+    if (chance) {
+      p_writer.WriteNumbers(list.size(), [&](size_t i) -> const Number & {
+        return infoset->GetActionProb(list[i]);
+      });
+    }
+  }
+
+  p_writer.WriteUnsigned<std::uint64_t>(nodes.size());
+  for (const auto &node : nodes) {
+    const auto parent = node->GetParent();
+    p_writer.WriteUnsigned<std::uint64_t>((parent) ? nodeIndex.at(parent.get()) : 0);
+  }
+  for (const auto &node : nodes) {
+    const auto infoset = node->GetInfoset();
+    p_writer.WriteUnsigned<std::uint64_t>((infoset) ? infosetIndex.at(infoset.get()) : 0);
+  }
+  for (const auto &node : nodes) {
+    const auto outcome = node->GetOutcome();
+    p_writer.WriteUnsigned<std::uint64_t>((outcome) ? outcome->GetNumber() : 0);
+  }
+  for (const auto &node : nodes) {
+    p_writer.WriteString(node->GetLabel());
+  }
+}
+
+//------------------------------------------------------------------------
+//                          Reading binary files
+//------------------------------------------------------------------------
+
+std::vector<GameOutcome> ReadOutcomes(BinaryReader &p_reader, const Game &p_game)
+{
+  std::vector<std::string> labels(p_reader.ReadCount<std::uint64_t>(sizeof(std::uint64_t)));
+  for (auto &label : labels) {
+    label = p_reader.ReadString();
+  }
+  const auto outcomes = p_game->NewOutcomes(labels);
+  for (const auto &player : p_game->GetPlayers()) {
+    const auto payoffs = p_reader.ReadNumbers(outcomes.size());
+    for (size_t i = 0; i < outcomes.size(); ++i) {
+      outcomes[i]->SetPayoff(player, payoffs[i]);
+    }
+  }
+  return outcomes;
+}
+
+Game ReadTable(BinaryReader &p_reader, const std::vector<std::string> &p_players)
+{
+  std::vector<std::vector<std::string>> strategies;
+  std::vector<int> dimensions;
+  for (size_t pl = 0; pl < p_players.size(); ++pl) {
+    strategies.push_back(p_reader.ReadStrings());
+    if (strategies.back().empty()) {
+      throw InvalidFileException("Each player must have at least one strategy");
+    }
+    dimensions.push_back(static_cast<int>(strategies.back().size()));
+  }
+  Game game = NewTable(dimensions, true);
+  std::map<std::string, std::string> playerLabels;
+  for (const auto &player : game->GetPlayers()) {
+    playerLabels[player->GetLabel()] = p_players[player->GetNumber() - 1];
+  }
+  game->RelabelPlayers(playerLabels);
+  for (const auto &player : game->GetPlayers()) {
+    std::map<std::string, std::string> labels;
+    for (const auto &strategy : player->GetStrategies()) {
+      labels[strategy->GetLabel()] =
+          strategies[player->GetNumber() - 1][strategy->GetNumber() - 1];
+    }
+    game->RelabelStrategies(player, labels);
+  }
+
+  const auto outcomes = ReadOutcomes(p_reader, game);
+  auto &table = dynamic_cast<GameTableRep &>(*game);
+  const auto map = static_cast<BinaryOutcomeMap>(p_reader.ReadUnsigned<std::uint8_t>());
+  if (map == BinaryOutcomeMap::Identity) {
+    std::vector<size_t> indices(outcomes.size());
+    std::iota(indices.begin(), indices.end(), 1);
+    table.SetOutcomeIndices(indices);
+  }
+  else if (map == BinaryOutcomeMap::Explicit) {
+    std::vector<size_t> indices(p_reader.ReadCount<std::uint64_t>(sizeof(std::uint64_t)));
+    for (auto &index : indices) {
+      index = p_reader.ReadUnsigned<std::uint64_t>();
+    }
+    table.SetOutcomeIndices(indices);
+  }
+  else {
+    throw InvalidFileException("Unknown assignment of outcomes in binary game file");
+  }
+  return game;
+}
+
+Game ReadTree(BinaryReader &p_reader, const std::vector<std::string> &p_players)
+{
+  auto tree = std::make_shared<GameTreeRep>();
+  Game game = tree;
+  if (!p_players.empty()) {
+    game->SetPlayers(p_players);
+  }
+  ReadOutcomes(p_reader, game);
+
+  GameTreeRep::Layout layout;
+  layout.m_infosets.resize(p_reader.ReadCount<std::uint64_t>(16));
+  for (auto &infoset : layout.m_infosets) {
+    infoset.m_player = p_reader.ReadUnsigned<std::uint32_t>();
+    if (infoset.m_player > p_players.size()) {
+      throw InvalidFileException("Reference to an undefined player in binary game file");
+    }
+    infoset.m_label = p_reader.ReadString();
+    infoset.m_actions = p_reader.ReadStrings();
+    if (infoset.m_player == 0) {
+      infoset.m_probs = p_reader.ReadNumbers(infoset.m_actions.size());
+    }
+  }
+
+  layout.m_nodes.resize(p_reader.ReadCount<std::uint64_t>(4 * sizeof(std::uint64_t)));
+  std::vector<size_t> parents(layout.m_nodes.size());
+  for (auto &parent : parents) {
+    parent = p_reader.ReadUnsigned<std::uint64_t>();
+  }
+  for (auto &node : layout.m_nodes) {
+    node.m_infoset = p_reader.ReadUnsigned<std::uint64_t>();
+    if (node.m_infoset > layout.m_infosets.size()) {
+      throw InvalidFileException("Index out of range in binary game file");
+    }
+  }
+  for (auto &node : layout.m_nodes) {
+    node.m_outcome = p_reader.ReadUnsigned<std::uint64_t>();
+  }
+  for (auto &node : layout.m_nodes) {
+    node.m_label = p_reader.ReadString();
+  }
+
+  // The parents are implied by the order of the nodes and the number of actions at each,
+  // so they serve to check that the nodes are listed in preorder.  Each entry of the
+  // stack is the parent of a position still to be filled, with the next one on top.
+  std::vector<size_t> positions{0};
+  for (size_t i = 0; i < layout.m_nodes.size(); ++i) {
+    if (positions.empty() || positions.back() != parents[i]) {
+      throw InvalidFileException("Nodes in binary game file are not in preorder");
+    }
+    positions.pop_back();
+    if (const auto infoset = layout.m_nodes[i].m_infoset; infoset > 0) {
+      positions.insert(positions.end(), layout.m_infosets[infoset - 1].m_actions.size(), i + 1);
+    }
+  }
+  if (!positions.empty()) {
+    throw InvalidFileException("Nodes in binary game file are not in preorder");
+  }
+  tree->BuildTree(layout);
+  return game;
+}
+
+} // end anonymous namespace
+
+Game ReadBinaryFile(std::istream &p_stream)
+{
+  std::ostringstream contents;
+  contents << p_stream.rdbuf();
+  const std::string data = std::move(contents).str();
+  BinaryReader reader(data);
+  try {
+    if (reader.ReadBytes(BinarySignature.size()) != BinarySignature) {
+      throw InvalidFileException("Not a binary game file");
+    }
+    if (reader.ReadUnsigned<std::uint32_t>() != BinaryVersion) {
+      throw InvalidFileException("Accepting only version 1 of binary game files");
+    }
+    const auto kind = static_cast<BinaryGameKind>(reader.ReadUnsigned<std::uint32_t>());
+    if (kind != BinaryGameKind::Table && kind != BinaryGameKind::Tree) {
+      throw InvalidFileException("Unknown kind of game in binary game file");
+    }
+    const auto title = reader.ReadString();
+    const auto description = reader.ReadString();
+    const auto players = reader.ReadStrings();
+    if (players.empty()) {
+      throw InvalidFileException("A game must have at least one player");
+    }
+    Game game = (kind == BinaryGameKind::Table) ? ReadTable(reader, players)
+                                                : ReadTree(reader, players);
+    if (!reader.AtEnd()) {
+      throw InvalidFileException("Unexpected data at end of binary game file");
+    }
+    game->SetTitle(title);
+    game->SetDescription(description);
+    return game;
+  }
+  catch (InvalidFileException &) {
+    throw;
+  }
+  catch (std::exception &ex) {
+    throw InvalidFileException(ex.what());
+  }
+}
+
+void WriteBinaryFile(const Game &p_game, std::ostream &p_stream)
+{
+  const bool isTable = dynamic_cast<const GameTableRep *>(p_game.get()) != nullptr;
+  if (!isTable && !p_game->IsTree()) {
+    throw UndefinedException("Only games in extensive form or as tables may be written "
+                             "in the binary format");
+  }
+  BinaryWriter writer(p_stream);
+  writer.WriteBytes(BinarySignature);
+  writer.WriteUnsigned(BinaryVersion);
+  writer.WriteUnsigned(static_cast<std::uint32_t>((isTable) ? BinaryGameKind::Table
+                                                            : BinaryGameKind::Tree));
+  writer.WriteString(p_game->GetTitle());
+  writer.WriteString(p_game->GetDescription());
+  std::vector<std::string> players;
+  for (const auto &player : p_game->GetPlayers()) {
+    players.push_back(player->GetLabel());
+  }
+  writer.WriteStrings(players);
+  if (isTable) {
+    WriteTable(writer, p_game);
+  }
+  else {
+    WriteTree(writer, p_game);
+  }
+  writer.Flush();
+}
+
+} // end namespace Gambit
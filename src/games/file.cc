@@ -25,10 +25,14 @@
 #include <fstream>
 #include <map>
 #include <set>
+#include <sstream>
+#include <string_view>
 #include <algorithm>
 
 #include "games.h"
 #include "gameagg.h"
+#include "gametable.h"
+#include "gametree.h"
 
 namespace {
 // This anonymous namespace encapsulates the file-parsing code
@@ -55,9 +59,14 @@ using GameFileToken = enum {
 };
 
 /// @brief Class implementing conversion of classic Gambit savefiles into lexical tokens.
+///
+/// The lexer reads from the whole text of the file held in memory, rather than pulling
+/// characters one at a time from a stream, so that tokens are taken as slices of it.
 class GameFileLexer {
 private:
-  std::istream &m_file;
+  std::string_view m_text;
+  size_t m_pos{0};
+  bool m_eof{false};
 
   int m_currentLine{1};
   int m_currentColumn{1};
@@ -69,7 +78,7 @@ private:
   void IncreaseLine();
 
 public:
-  explicit GameFileLexer(std::istream &p_file) : m_file(p_file) {}
+  explicit GameFileLexer(std::string_view p_text) : m_text(p_text) {}
 
   GameFileToken GetNextToken();
   GameFileToken GetCurrentToken() const { return m_lastToken; }
@@ -105,14 +114,20 @@ void GameFileLexer::OnParseError(const std::string &p_message) const
 
 void GameFileLexer::ReadChar(char &c)
 {
-  m_file.get(c);
+  // As with std::istream::get(), c is left unchanged at the end of the text
+  if (m_pos < m_text.size()) {
+    c = m_text[m_pos++];
+  }
+  else {
+    m_eof = true;
+  }
   m_currentColumn++;
 }
 
 void GameFileLexer::UnreadChar()
 {
-  if (!m_file.eof()) {
-    m_file.unget();
+  if (!m_eof) {
+    m_pos--;
     m_currentColumn--;
   }
 }
@@ -126,13 +141,13 @@ void GameFileLexer::IncreaseLine()
 GameFileToken GameFileLexer::GetNextToken()
 {
   char c = ' ';
-  if (m_file.eof()) {
+  if (m_eof) {
     return (m_lastToken = TOKEN_EOF);
   }
 
   while (IsAsciiSpace(c)) {
     ReadChar(c);
-    if (m_file.eof()) {
+    if (m_eof) {
       return (m_lastToken = TOKEN_EOF);
     }
     else if (c == '\n') {
@@ -150,90 +165,76 @@ GameFileToken GameFileLexer::GetNextToken()
     return (m_lastToken = TOKEN_COMMA);
   }
   else if (IsAsciiDigit(c) || c == '-' || c == '+') {
-    std::string buf;
-    buf += c;
+    const size_t start = m_pos - 1;
     ReadChar(c);
 
-    while (!m_file.eof() && IsAsciiDigit(c)) {
-      buf += c;
+    while (!m_eof && IsAsciiDigit(c)) {
       ReadChar(c);
     }
 
-    if (m_file.eof()) {
-      m_lastText = buf;
+    if (m_eof) {
+      m_lastText = m_text.substr(start, m_pos - start);
       return (m_lastToken = TOKEN_NUMBER);
     }
 
     if (c == '.') {
-      buf += c;
       ReadChar(c);
-      while (!m_file.eof() && IsAsciiDigit(c)) {
-        buf += c;
+      while (!m_eof && IsAsciiDigit(c)) {
         ReadChar(c);
       }
 
       if (c == 'e' || c == 'E') {
-        buf += c;
         ReadChar(c);
         if (c != '+' && c != '-' && !IsAsciiDigit(c)) {
           OnParseError("Invalid Token +/-");
         }
-        buf += c;
         ReadChar(c);
-        while (!m_file.eof() && IsAsciiDigit(c)) {
-          buf += c;
+        while (!m_eof && IsAsciiDigit(c)) {
           ReadChar(c);
         }
       }
 
       UnreadChar();
-      m_lastText = buf;
+      m_lastText = m_text.substr(start, m_pos - start);
       return (m_lastToken = TOKEN_NUMBER);
     }
     else if (c == '/') {
-      buf += c;
       ReadChar(c);
-      while (!m_file.eof() && IsAsciiDigit(c)) {
-        buf += c;
+      while (!m_eof && IsAsciiDigit(c)) {
         ReadChar(c);
       }
       UnreadChar();
-      m_lastText = buf;
+      m_lastText = m_text.substr(start, m_pos - start);
       return (m_lastToken = TOKEN_NUMBER);
     }
     else if (c == 'e' || c == 'E') {
-      buf += c;
       ReadChar(c);
       if (c != '+' && c != '-' && !IsAsciiDigit(c)) {
         OnParseError("Invalid Token +/-");
       }
-      buf += c;
       ReadChar(c);
-      while (!m_file.eof() && IsAsciiDigit(c)) {
-        buf += c;
+      while (!m_eof && IsAsciiDigit(c)) {
         ReadChar(c);
       }
       UnreadChar();
-      m_lastText = buf;
+      m_lastText = m_text.substr(start, m_pos - start);
       return (m_lastToken = TOKEN_NUMBER);
     }
     else {
       UnreadChar();
-      m_lastText = buf;
+      m_lastText = m_text.substr(start, m_pos - start);
       return (m_lastToken = TOKEN_NUMBER);
     }
   }
   else if (c == '.') {
-    std::string buf;
-    buf += c;
+    const size_t start = m_pos - 1;
     ReadChar(c);
 
-    while (!m_file.eof() && IsAsciiDigit(c)) {
-      buf += c;
+    while (!m_eof && IsAsciiDigit(c)) {
       ReadChar(c);
     }
     UnreadChar();
-    m_lastText = buf;
+    m_lastText = m_text.substr(start, m_pos - start);
     return (m_lastToken = TOKEN_NUMBER);
   }
 
@@ -250,14 +251,14 @@ GameFileToken GameFileLexer::GetNextToken()
       if (a == '\n') {
         IncreaseLine();
       }
-    } while (!m_file.eof() && IsAsciiSpace(a));
+    } while (!m_eof && IsAsciiSpace(a));
 
     if (a == '\"') {
       bool lastslash = false;
 
       ReadChar(a);
       while (a != '\"' || lastslash) {
-        if (m_file.eof() || !m_file.good()) {
+        if (m_eof) {
           OnParseError("End of file encountered when reading string label");
         }
         if (lastslash && a == '"') {
@@ -279,7 +280,7 @@ GameFileToken GameFileLexer::GetNextToken()
       do {
         m_lastText += a;
         ReadChar(a);
-        if (m_file.eof()) {
+        if (m_eof) {
           OnParseError("End of file encountered when reading string label");
         }
         if (a == '\n') {
@@ -292,13 +293,21 @@ GameFileToken GameFileLexer::GetNextToken()
   }
 
   m_lastText = "";
-  while (!m_file.eof() && !IsAsciiSpace(c)) {
+  while (!m_eof && !IsAsciiSpace(c)) {
     m_lastText += c;
     ReadChar(c);
   }
   return (m_lastToken = TOKEN_SYMBOL);
 }
 
+/// Returns the remaining text of p_stream, which is read in one go
+std::string ReadText(std::istream &p_stream)
+{
+  std::ostringstream text;
+  text << p_stream.rdbuf();
+  return std::move(text).str();
+}
+
 class TableFilePlayer {
 public:
   std::string m_name;
@@ -471,8 +480,9 @@ void ReadOutcomeList(GameFileLexer &p_parser, Game &p_nfg)
   p_parser.GetNextToken();
 
   NormalizeLabelStrings(labels);
+  const auto outcomes = p_nfg->NewOutcomes(labels);
   for (size_t i = 0; i < labels.size(); ++i) {
-    auto outcome = p_nfg->NewOutcome(labels[i]);
+    const auto &outcome = outcomes[i];
     auto player_it = players.begin();
     for (const auto &payoff : payoff_lists[i]) {
       outcome->SetPayoff(*player_it, payoff);
@@ -495,13 +505,20 @@ void ParseOutcomeBody(GameFileLexer &p_parser, Game &p_nfg)
 
 void ParsePayoffBody(GameFileLexer &p_parser, Game &p_nfg)
 {
-  for (const auto &profile : StrategyContingencies(p_nfg)) {
-    for (const auto &player : p_nfg->GetPlayers()) {
-      p_parser.ExpectCurrentToken(TOKEN_NUMBER, "numerical payoff");
-      profile->GetOutcome()->SetPayoff(player, Number(p_parser.GetLastText()));
-      p_parser.GetNextToken();
-    }
+  // The payoffs are listed in the order in which the table holds them, so they are
+  // collected and handed over all at once, rather than set through each contingency
+  size_t count = p_nfg->GetPlayers().size();
+  for (const auto &player : p_nfg->GetPlayers()) {
+    count *= player->GetStrategies().size();
+  }
+  std::vector<Number> payoffs;
+  payoffs.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    p_parser.ExpectCurrentToken(TOKEN_NUMBER, "numerical payoff");
+    payoffs.emplace_back(p_parser.GetLastText());
+    p_parser.GetNextToken();
   }
+  dynamic_cast<GameTableRep &>(*p_nfg).SetPayoffs(std::move(payoffs));
 }
 
 Game BuildNfg(GameFileLexer &p_parser, TableFileGame &p_data)
@@ -571,9 +588,13 @@ public:
   /// creation order (and hence numbering) of the outcomes, matching the
   /// order in which the previous implementation created them.
   std::vector<int> m_outcomeOrder;
-  /// Deferred node-to-outcome attachments, replayed after outcomes are created.
-  std::vector<std::pair<GameNode, int>> m_nodeOutcomes;
-  std::map<int, std::map<int, GameInfoset>> m_infosetMap;
+  /// The outcome id of each node in preorder (0 for none), which is translated into
+  /// the number of the outcome once the outcomes are created.
+  std::vector<int> m_nodeOutcomes;
+  /// The index in the layout of each information set, by player and id in the file
+  std::map<int, std::map<int, size_t>> m_infosetMap;
+  /// The tree as read so far, which is built in one step once the file has been read
+  GameTreeRep::Layout m_layout;
 };
 
 void ReadPlayers(GameFileLexer &p_state, Game &p_game, TreeData &p_treeData)
@@ -619,7 +640,7 @@ void CheckOutcomeDefinition(const GameFileLexer &p_state, int p_outcomeId,
   }
 }
 
-void ParseOutcome(GameFileLexer &p_state, Game &p_game, TreeData &p_treeData, GameNode &p_node)
+void ParseOutcome(GameFileLexer &p_state, const Game &p_game, TreeData &p_treeData)
 {
   p_state.ExpectCurrentToken(TOKEN_NUMBER, "index of outcome");
   const int outcomeId = std::stoi(p_state.GetLastText());
@@ -651,7 +672,6 @@ void ParseOutcome(GameFileLexer &p_state, Game &p_game, TreeData &p_treeData, Ga
       CheckOutcomeDefinition(p_state, outcomeId, p_treeData.m_outcomeRecords.at(outcomeId), label,
                              payoffs);
     }
-    p_treeData.m_nodeOutcomes.emplace_back(p_node, outcomeId);
   }
   else if (outcomeId != 0) {
     // The node entry does not contain information about the outcome.
@@ -659,17 +679,18 @@ void ParseOutcome(GameFileLexer &p_state, Game &p_game, TreeData &p_treeData, Ga
     if (!p_treeData.m_outcomeRecords.contains(outcomeId)) {
       p_state.OnParseError("Outcome not defined");
     }
-    p_treeData.m_nodeOutcomes.emplace_back(p_node, outcomeId);
   }
+  p_treeData.m_nodeOutcomes.push_back(outcomeId);
 }
 
-/// Create the game's outcomes from the definitions buffered during the parse.
+/// Create the game's outcomes from the definitions buffered during the parse,
+/// and record the outcome of each node in the layout of the tree.
 /// Labels are normalized in first-occurrence order before creation, so that
 /// the label requirements enforced by NewOutcome (nonempty, unique) are
 /// satisfied; this matches the treatment of outcome labels read from .nfg
 /// files, and produces the same labels the previous post-parse normalization
 /// pass produced.
-void CreateOutcomes(const Game &p_game, const TreeData &p_treeData)
+void CreateOutcomes(const Game &p_game, TreeData &p_treeData)
 {
   std::vector<std::string> labels;
   for (const int id : p_treeData.m_outcomeOrder) {
@@ -677,210 +698,173 @@ void CreateOutcomes(const Game &p_game, const TreeData &p_treeData)
   }
   NormalizeLabelStrings(labels);
 
-  std::map<int, GameOutcome> created;
-  auto label_it = labels.begin();
+  std::map<int, size_t> created;
+  const auto outcomes = p_game->NewOutcomes(labels);
+  auto outcome_it = outcomes.begin();
   for (const int id : p_treeData.m_outcomeOrder) {
-    auto outcome = p_game->NewOutcome(*label_it++);
+    const auto &outcome = *outcome_it++;
     auto player_it = p_game->GetPlayers().begin();
     for (const auto &payoff : p_treeData.m_outcomeRecords.at(id).m_payoffs) {
       outcome->SetPayoff(*player_it, payoff);
       ++player_it;
     }
-    created.emplace(id, outcome);
+    created.emplace(id, outcome->GetNumber());
   }
-  for (const auto &[node, id] : p_treeData.m_nodeOutcomes) {
-    p_game->SetOutcome(node, created.at(id));
+  auto node_it = p_treeData.m_layout.m_nodes.begin();
+  for (const int id : p_treeData.m_nodeOutcomes) {
+    (node_it++)->m_outcome = (id == 0) ? 0 : created.at(id);
   }
 }
 
 void CheckInfosetActions(const GameFileLexer &p_state, const int p_playerId, const int p_infosetId,
-                         const GameInfoset &p_infoset, const std::string &p_label,
-                         const std::list<std::string> &p_labels)
+                         const GameTreeRep::Layout::Infoset &p_infoset, const std::string &p_label,
+                         const std::vector<std::string> &p_labels)
 {
-  if (p_infoset->GetLabel() != p_label) {
+  if (p_infoset.m_label != p_label) {
     p_state.OnParseError("Infoset labels does not match previous definition "
                          "(player " +
                          std::to_string(p_playerId) + ", infoset " + std::to_string(p_infosetId) +
                          ")");
   }
 
-  // The infoset's actual labels are normalized at creation (see ParseNode/ParsePersonalNode),
+  // The infoset's actual labels are normalized at creation (see ParseInfoset),
   // so a later restatement of the same infoset must be normalized the same way before
   // comparing, or a file that consistently repeats a duplicate/empty action label would be
   // (incorrectly) rejected as inconsistent.
   auto normalized_labels = p_labels;
   NormalizeLabelStrings(normalized_labels);
 
-  const auto &actions = p_infoset->GetActions();
-  if (actions.size() != normalized_labels.size()) {
+  if (p_infoset.m_actions.size() != normalized_labels.size()) {
     p_state.OnParseError("Infoset action count mismatch "
                          "(player " +
                          std::to_string(p_playerId) + ", infoset " + std::to_string(p_infosetId) +
                          ")");
   }
-  auto label_it = normalized_labels.begin();
-  for (auto action : actions) {
-    if (action->GetLabel() != *label_it) {
-      p_state.OnParseError("Infoset action labels do not match previous definition "
-                           "(player " +
-                           std::to_string(p_playerId) + ", infoset " +
-                           std::to_string(p_infosetId) + ")");
-    }
-    ++label_it;
+  if (p_infoset.m_actions != normalized_labels) {
+    p_state.OnParseError("Infoset action labels do not match previous definition "
+                         "(player " +
+                         std::to_string(p_playerId) + ", infoset " + std::to_string(p_infosetId) +
+                         ")");
   }
 }
 
 void CheckChanceProbs(const GameFileLexer &p_state, const int p_infosetId,
-                      const GameInfoset &p_infoset, const Array<Number> &p_probs)
+                      const GameTreeRep::Layout::Infoset &p_infoset,
+                      const std::vector<Number> &p_probs)
 {
-  if (p_infoset->GetActions().size() != p_probs.size()) {
+  if (p_infoset.m_probs.size() != p_probs.size()) {
     p_state.OnParseError("Chance infoset probability count mismatch "
                          "(infoset " +
                          std::to_string(p_infosetId) + ")");
   }
-  auto action_it = p_infoset->GetActions().begin();
-  for (size_t i = 1; i <= p_probs.size(); ++i) {
-    if (static_cast<const std::string &>(p_infoset->GetActionProb(*action_it)) !=
+  for (size_t i = 0; i < p_probs.size(); ++i) {
+    if (static_cast<const std::string &>(p_infoset.m_probs[i]) !=
         static_cast<const std::string &>(p_probs[i])) {
       p_state.OnParseError("Chance infoset probabilities do not match previous definition "
                            "(infoset " +
                            std::to_string(p_infosetId) + ")");
     }
-    ++action_it;
   }
 }
 
-void ParseNode(GameFileLexer &p_state, Game p_game, GameNode p_node, TreeData &p_treeData);
-
-void ParseChanceNode(GameFileLexer &p_state, Game &p_game, GameNode &p_node, TreeData &p_treeData)
+/// Reads the reference to the information set at a chance (p_playerId == 0) or personal
+/// node, together with its definition if it is given there, and returns the index of the
+/// information set in the layout of the tree.
+size_t ParseInfoset(GameFileLexer &p_state, TreeData &p_treeData, const int p_playerId)
 {
-  p_state.ExpectNextToken(TOKEN_TEXT, "node label");
-  p_node->SetLabel(p_state.GetLastText());
-
   p_state.ExpectNextToken(TOKEN_NUMBER, "infoset id");
-  const int infosetId = atoi(p_state.GetLastText().c_str());
-  GameInfoset infoset = p_treeData.m_infosetMap[0][infosetId];
+  const int infosetId = std::stoi(p_state.GetLastText());
+  auto &infosets = p_treeData.m_layout.m_infosets;
+  auto &playerInfosets = p_treeData.m_infosetMap[p_playerId];
+  const auto entry = playerInfosets.find(infosetId);
+  const size_t index = (entry != playerInfosets.end()) ? entry->second : 0;
 
-  if (p_state.GetNextToken() == TOKEN_TEXT) {
-    // Information set data is specified
-    std::list<std::string> action_labels;
-    Array<Number> probs;
+  if (p_state.GetNextToken() != TOKEN_TEXT) {
+    if (index == 0) {
+      p_state.OnParseError("Referencing an undefined infoset");
+    }
+    return index;
+  }
 
-    const std::string label = p_state.GetLastText();
-    p_state.ExpectNextToken(TOKEN_LBRACE, "'{'");
-    p_state.GetNextToken();
-    do {
-      p_state.ExpectCurrentToken(TOKEN_TEXT, "action label");
-      action_labels.push_back(p_state.GetLastText());
+  // Information set data is specified
+  std::vector<std::string> action_labels;
+  std::vector<Number> probs;
+  const std::string label = p_state.GetLastText();
+  p_state.ExpectNextToken(TOKEN_LBRACE, "'{'");
+  p_state.GetNextToken();
+  do {
+    p_state.ExpectCurrentToken(TOKEN_TEXT, "action label");
+    action_labels.push_back(p_state.GetLastText());
+    if (p_playerId == 0) {
       p_state.ExpectNextToken(TOKEN_NUMBER, "action probability");
-      probs.push_back(Number(p_state.GetLastText()));
-      p_state.GetNextToken();
-    } while (p_state.GetCurrentToken() != TOKEN_RBRACE);
+      probs.emplace_back(p_state.GetLastText());
+    }
     p_state.GetNextToken();
+  } while (p_state.GetCurrentToken() != TOKEN_RBRACE);
+  p_state.GetNextToken();
 
-    if (!infoset) {
-      auto normalized_labels = action_labels;
-      NormalizeLabelStrings(normalized_labels);
-      infoset = p_game->AppendEvent(
-          p_node, std::vector<std::string>(normalized_labels.begin(), normalized_labels.end()),
-          std::vector<Number>(probs.begin(), probs.end()));
-      p_treeData.m_infosetMap[0][infosetId] = infoset;
-      infoset->SetLabel(label);
-    }
-    else {
-      CheckInfosetActions(p_state, 0, infosetId, infoset, label, action_labels);
-      CheckChanceProbs(p_state, infosetId, infoset, probs);
-      p_game->AppendMove(p_node, infoset);
+  if (index != 0) {
+    CheckInfosetActions(p_state, p_playerId, infosetId, infosets[index - 1], label,
+                        action_labels);
+    if (p_playerId == 0) {
+      CheckChanceProbs(p_state, infosetId, infosets[index - 1], probs);
     }
-  }
-  else if (infoset) {
-    p_game->AppendMove(p_node, infoset);
-  }
-  else {
-    p_state.OnParseError("Referencing an undefined infoset");
-  }
-
-  ParseOutcome(p_state, p_game, p_treeData, p_node);
-  for (auto child : p_node->GetChildren()) {
-    ParseNode(p_state, p_game, child, p_treeData);
-  }
+    return index;
+  }
+  // Labels are checked as they are read, as well as when the tree is built, so that an
+  // invalid label is reported even if the file is malformed further on
+  CheckLabel(label);
+  NormalizeLabelStrings(action_labels);
+  std::for_each(action_labels.begin(), action_labels.end(), CheckLabel);
+  infosets.push_back(
+      {static_cast<size_t>(p_playerId), label, std::move(action_labels), std::move(probs)});
+  playerInfosets[infosetId] = infosets.size();
+  return infosets.size();
 }
 
-void ParsePersonalNode(GameFileLexer &p_state, Game p_game, GameNode p_node, TreeData &p_treeData)
+/// Reads the entry of a node, appending it to the layout of the tree, and returns the
+/// number of children of the node, which follow it in the file.
+size_t ParseNode(GameFileLexer &p_state, const Game &p_game, TreeData &p_treeData)
 {
+  const std::string type = p_state.GetLastText();
+  if (type != "c" && type != "p" && type != "t") {
+    p_state.OnParseError("Invalid type of node");
+  }
   p_state.ExpectNextToken(TOKEN_TEXT, "node label");
-  p_node->SetLabel(p_state.GetLastText());
-
-  p_state.ExpectNextToken(TOKEN_NUMBER, "player id");
-  const int playerId = std::stoi(p_state.GetLastText());
-  const GamePlayer player = p_game->GetPlayer(playerId);
-
-  p_state.ExpectNextToken(TOKEN_NUMBER, "infoset id");
-  const int infosetId = std::stoi(p_state.GetLastText());
-  GameInfoset infoset = p_treeData.m_infosetMap[playerId][infosetId];
-
-  if (p_state.GetNextToken() == TOKEN_TEXT) {
-    // Information set data is specified
-    std::list<std::string> action_labels;
-    const std::string label = p_state.GetLastText();
-
-    p_state.ExpectNextToken(TOKEN_LBRACE, "'{'");
-    p_state.GetNextToken();
-    do {
-      p_state.ExpectCurrentToken(TOKEN_TEXT, "action label");
-      action_labels.push_back(p_state.GetLastText());
-      p_state.GetNextToken();
-    } while (p_state.GetCurrentToken() != TOKEN_RBRACE);
-    p_state.GetNextToken();
+  GameTreeRep::Layout::Node node{0, 0, p_state.GetLastText()};
+  CheckLabel(node.m_label);
 
-    if (!infoset) {
-      auto normalized_labels = action_labels;
-      NormalizeLabelStrings(normalized_labels);
-      infoset = p_game->AppendMove(
-          p_node, player,
-          std::vector<std::string>(normalized_labels.begin(), normalized_labels.end()));
-      p_treeData.m_infosetMap[playerId][infosetId] = infoset;
-      infoset->SetLabel(label);
-    }
-    else {
-      CheckInfosetActions(p_state, playerId, infosetId, infoset, label, action_labels);
-      p_game->AppendMove(p_node, infoset);
-    }
+  if (type == "c") {
+    node.m_infoset = ParseInfoset(p_state, p_treeData, 0);
   }
-  else if (infoset) {
-    p_game->AppendMove(p_node, infoset);
+  else if (type == "p") {
+    p_state.ExpectNextToken(TOKEN_NUMBER, "player id");
+    const int playerId = std::stoi(p_state.GetLastText());
+    if (playerId < 1 || playerId > static_cast<int>(p_game->GetPlayers().size())) {
+      p_state.OnParseError("Invalid player id");
+    }
+    node.m_infoset = ParseInfoset(p_state, p_treeData, playerId);
   }
   else {
-    p_state.OnParseError("Referencing an undefined infoset");
+    p_state.GetNextToken();
   }
+  ParseOutcome(p_state, p_game, p_treeData);
 
-  ParseOutcome(p_state, p_game, p_treeData, p_node);
-  for (auto child : p_node->GetChildren()) {
-    ParseNode(p_state, p_game, child, p_treeData);
-  }
+  const auto &infosets = p_treeData.m_layout.m_infosets;
+  const size_t children =
+      (node.m_infoset == 0) ? 0 : infosets[node.m_infoset - 1].m_actions.size();
+  p_treeData.m_layout.m_nodes.push_back(std::move(node));
+  return children;
 }
 
-void ParseTerminalNode(GameFileLexer &p_state, Game p_game, GameNode p_node, TreeData &p_treeData)
+/// Reads the nodes of the tree, which are listed in preorder.  Each node takes the next
+/// position left open by the nodes before it, so the tree is complete once no positions
+/// remain, and its depth is limited only by the memory for the layout.
+void ParseTree(GameFileLexer &p_state, const Game &p_game, TreeData &p_treeData)
 {
-  p_state.ExpectNextToken(TOKEN_TEXT, "node label");
-  p_node->SetLabel(p_state.GetLastText());
-  p_state.GetNextToken();
-  ParseOutcome(p_state, p_game, p_treeData, p_node);
-}
-
-void ParseNode(GameFileLexer &p_state, Game p_game, GameNode p_node, TreeData &p_treeData)
-{
-  if (p_state.GetLastText() == "c") {
-    ParseChanceNode(p_state, p_game, p_node, p_treeData);
-  }
-  else if (p_state.GetLastText() == "p") {
-    ParsePersonalNode(p_state, p_game, p_node, p_treeData);
-  }
-  else if (p_state.GetLastText() == "t") {
-    ParseTerminalNode(p_state, p_game, p_node, p_treeData);
-  }
-  else {
-    p_state.OnParseError("Invalid type of node");
+  size_t openPositions = 1;
+  while (openPositions > 0) {
+    openPositions += ParseNode(p_state, p_game, p_treeData) - 1;
   }
 }
 
@@ -893,14 +877,18 @@ namespace Gambit {
 void NormalizeGameLabels(const Game &p_game)
 {
   const auto get_label = [](const auto &e) { return e->GetLabel(); };
-  const auto set_label = [](const auto &e, const std::string &s) { e->SetLabel(s); };
   const auto relabel_player = [&p_game](const auto &e, const std::string &s) {
     p_game->RelabelPlayers({{e->GetLabel(), s}});
   };
   NormalizeLabels(p_game->GetPlayers(), get_label, relabel_player);
-  NormalizeLabels(p_game->GetOutcomes(), get_label, set_label);
-  // Action labels are not normalized here: for tree games, ParseNode/ParsePersonalNode
-  // already normalize each infoset's actions individually, at creation, from the raw
+  std::vector<std::string> outcomeLabels;
+  for (const auto &outcome : p_game->GetOutcomes()) {
+    outcomeLabels.push_back(outcome->GetLabel());
+  }
+  NormalizeLabelStrings(outcomeLabels);
+  p_game->RelabelOutcomes(outcomeLabels);
+  // Action labels are not normalized here: for tree games, ParseInfoset
+  // already normalizes each infoset's actions individually, at creation, from the raw
   // labels as parsed (see there for why the raw labels must be kept around too).
   // Strategy labels are not normalized here either: every strategic-form construction
   // path (BuildNfg via RelabelStrategies, and the "1".."N" numbering GameAGGRep/
@@ -908,9 +896,11 @@ void NormalizeGameLabels(const Game &p_game)
   // by the time a game reaches here.
 }
 
-Game ReadEfgFile(std::istream &p_stream)
+namespace {
+
+Game ReadEfgText(std::string_view p_text)
 {
-  GameFileLexer parser(p_stream);
+  GameFileLexer parser(p_text);
 
   if (parser.GetNextToken() != TOKEN_SYMBOL || parser.GetLastText() != "EFG") {
     parser.OnParseError("Expecting EFG file type indicator");
@@ -927,7 +917,8 @@ Game ReadEfgFile(std::istream &p_stream)
   }
 
   TreeData treeData;
-  Game game = NewTree();
+  auto tree = std::make_shared<GameTreeRep>();
+  Game game = tree;
   game->SetTitle(parser.GetLastText());
   ReadPlayers(parser, game, treeData);
   if (parser.GetNextToken() == TOKEN_TEXT) {
@@ -935,15 +926,16 @@ Game ReadEfgFile(std::istream &p_stream)
     game->SetDescription(parser.GetLastText());
     parser.GetNextToken();
   }
-  ParseNode(parser, game, game->GetRoot(), treeData);
+  ParseTree(parser, game, treeData);
   CreateOutcomes(game, treeData);
+  tree->BuildTree(treeData.m_layout);
   NormalizeGameLabels(game);
   return game;
 }
 
-Game ReadNfgFile(std::istream &p_stream)
+Game ReadNfgText(std::string_view p_text)
 {
-  GameFileLexer parser(p_stream);
+  GameFileLexer parser(p_text);
   TableFileGame data;
   ParseNfgHeader(parser, data);
   // Normalize player and strategy labels on the raw lists before the game is
@@ -970,6 +962,12 @@ Game ReadNfgFile(std::istream &p_stream)
   return game;
 }
 
+} // end anonymous namespace
+
+Game ReadEfgFile(std::istream &p_stream) { return ReadEfgText(ReadText(p_stream)); }
+
+Game ReadNfgFile(std::istream &p_stream) { return ReadNfgText(ReadText(p_stream)); }
+
 Game ReadGbtFile(std::istream &p_stream)
 {
   try {
@@ -1013,34 +1011,43 @@ Game ReadBaggFile(std::istream &p_stream)
 
 Game ReadGame(std::istream &p_file)
 {
-  std::stringstream buffer;
-  buffer << p_file.rdbuf();
-  if (buffer.str().empty()) {
-    throw InvalidFileException("Empty file or string provided");
+  // Files in the binary format are recognised by their first byte, which is not ASCII
+  if (p_file.peek() == 0x89) {
+    return ReadBinaryFile(p_file);
   }
-  try {
-    return ReadGbtFile(buffer);
+  const std::string text = ReadText(p_file);
+  if (text.empty()) {
+    throw InvalidFileException("Empty file or string provided");
   }
-  catch (InvalidFileException &) {
-    buffer.seekg(0, std::ios::beg);
+  // A savefile of the graphical interface is an XML document, which must begin with
+  // markup; only then is it worth parsing the text as one
+  if (const auto start = text.find_first_not_of(" \t\r\n");
+      start != std::string::npos && text[start] == '<') {
+    try {
+      std::istringstream buffer(text);
+      return ReadGbtFile(buffer);
+    }
+    catch (InvalidFileException &) {
+    }
   }
 
-  GameFileLexer parser(buffer);
+  GameFileLexer parser(text);
   try {
     if (parser.GetNextToken() != TOKEN_SYMBOL) {
       parser.OnParseError("Expecting file type");
     }
-    buffer.seekg(0, std::ios::beg);
     if (parser.GetLastText() == "NFG") {
-      return ReadNfgFile(buffer);
+      return ReadNfgText(text);
     }
     if (parser.GetLastText() == "EFG") {
-      return ReadEfgFile(buffer);
+      return ReadEfgText(text);
     }
     if (parser.GetLastText() == "#AGG") {
+      std::istringstream buffer(text);
       return ReadAggFile(buffer);
     }
     if (parser.GetLastText() == "#BAGG") {
+      std::istringstream buffer(text);
       return ReadBaggFile(buffer);
     }
     throw InvalidFileException("Unrecognized file format");
@@ -275,6 +275,33 @@ void GameRep::RelabelPlayers(const std::map<std::string, std::string> &p_labels)
   }
 }
 
+//------------------------------------------------------------------------
+//                           GameRep: Outcomes
+//------------------------------------------------------------------------
+
+void GameRep::RelabelOutcomes(const std::vector<std::string> &p_labels)
+{
+  if (p_labels.size() != m_outcomes.size()) {
+    throw DimensionException("Number of labels does not match number of outcomes");
+  }
+  // Checking against each other outcome in turn, as SetLabel does, would be quadratic
+  // in the number of outcomes, which for a table game is the number of contingencies
+  std::set<std::string> targets;
+  for (const auto &label : p_labels) {
+    if (label.empty()) {
+      throw ValueException("Outcome label must not be empty");
+    }
+    CheckLabel(label);
+    if (!targets.insert(label).second) {
+      throw ValueException("Outcome label '" + label +
+                           "' would be duplicated by the relabelling");
+    }
+  }
+  for (size_t i = 0; i < p_labels.size(); ++i) {
+    m_outcomes[i]->m_label = p_labels[i];
+  }
+}
+
 //========================================================================
 //                     MixedStrategyProfileRep<T>
 //========================================================================
@@ -310,6 +337,25 @@ template <class T> void MixedStrategyProfileRep<T>::SetCentroid()
   }
 }
 
+template <class T> void MixedStrategyProfileRep<T>::GetPayoffDerivs(Matrix<T> &p_derivs) const
+{
+  p_derivs = T{0};
+  for (const auto &player1 : m_support.GetPlayers()) {
+    for (const auto &strategy1 : m_support.GetStrategies(player1)) {
+      const int row = m_profileIndex.at(strategy1);
+      for (const auto &player2 : m_support.GetPlayers()) {
+        if (player2 == player1) {
+          continue;
+        }
+        for (const auto &strategy2 : m_support.GetStrategies(player2)) {
+          p_derivs(row, m_profileIndex.at(strategy2)) =
+              GetPayoffDeriv(player1->GetNumber(), strategy1, strategy2);
+        }
+      }
+    }
+  }
+}
+
 template <class T>
 std::unique_ptr<MixedStrategyProfileRep<T>> MixedStrategyProfileRep<T>::Normalize() const
 {
@@ -326,6 +326,7 @@ inline void CheckText(const std::string &p_text)
 /// This class represents an outcome in a game.  An outcome
 /// specifies a vector of payoffs to players.
 class GameOutcomeRep : public std::enable_shared_from_this<GameOutcomeRep> {
+  friend class GameRep;
   friend class GameExplicitRep;
   friend class GameTreeRep;
   friend class GameTableRep;
@@ -496,6 +497,7 @@ class GameStrategyRep : public std::enable_shared_from_this<GameStrategyRep> {
   friend class StrategySupportProfile;
   template <class T> friend class MixedStrategyProfile;
   template <class T> friend class TableMixedStrategyProfileRep;
+  template <class T> friend class TreeMixedStrategyProfileRep;
   template <class T> friend class MixedBehaviorProfile;
 
   bool m_valid{true};
@@ -903,7 +905,7 @@ public:
 template <class T> class CartesianTensor {
 public:
   const CartesianProductSpace *m_space{nullptr};
-  std::vector<T> m_data;
+  std::vector<T, AlignedAllocator<T>> m_data;
 };
 
 /// This is the class for representing an arbitrary finite game.
@@ -1427,6 +1429,15 @@ public:
   }
   /// Creates a new outcome in the game
   virtual GameOutcome NewOutcome(const std::string &p_label) { throw UndefinedException(); }
+  /// Creates a new outcome in the game with each of the labels, which must be valid,
+  /// pairwise distinct, and distinct from the labels of the existing outcomes
+  virtual std::vector<GameOutcome> NewOutcomes(const std::vector<std::string> &p_labels)
+  {
+    throw UndefinedException();
+  }
+  /// Reassign the labels of all the outcomes of the game, which are given in order.
+  /// The labels must be valid and pairwise distinct.
+  void RelabelOutcomes(const std::vector<std::string> &p_labels);
   /// Deletes the specified outcome from the game
   virtual void DeleteOutcome(const GameOutcome &) { throw UndefinedException(); }
   //@}
@@ -1737,9 +1748,24 @@ inline Game GameSubgameRep::GetGame() const { return m_game->shared_from_this();
 /// @sa ReadEfgFile, ReadNfgFile, ReadAggFile, ReadBaggFile
 [[nodiscard]] Game ReadGbtFile(std::istream &p_stream);
 
+/// @brief Reads a game representation in Gambit's binary format
+/// @param[in] p_stream An input stream, positioned at the start of the binary data
+/// @return A handle to the game representation constructed
+/// @throw InvalidFileException If the stream does not contain a valid serialisation
+///                             of a game in the binary format.
+/// @sa WriteBinaryFile, ReadEfgFile, ReadNfgFile
+[[nodiscard]] Game ReadBinaryFile(std::istream &p_stream);
+
+/// @brief Writes a game in Gambit's binary format
+/// @param[in] p_game The game, which must be a tree or a table
+/// @param[in] p_stream An output stream, which should be opened in binary mode
+/// @throw UndefinedException If the game is neither a tree nor a table
+/// @sa ReadBinaryFile
+void WriteBinaryFile(const Game &p_game, std::ostream &p_stream);
+
 /// @brief Reads a game from the input stream, attempting to autodetect file format
 /// @deprecated Deprecated in favour of the various ReadXXXGame functions.
-/// @sa ReadEfgFile, ReadNfgFile, ReadGbtFile, ReadAggFile, ReadBaggFile
+/// @sa ReadEfgFile, ReadNfgFile, ReadGbtFile, ReadAggFile, ReadBaggFile, ReadBinaryFile
 [[nodiscard]] Game ReadGame(std::istream &p_stream);
 
 /// @brief Generate a distribution over a simplex restricted to rational numbers of given
@@ -22,6 +22,7 @@
 
 #include <iostream>
 #include <numeric>
+#include <set>
 
 #include "games.h"
 #include "gameexpl.h"
@@ -65,6 +66,32 @@ GameOutcome GameExplicitRep::NewOutcome(const std::string &p_label)
   return m_outcomes.back();
 }
 
+std::vector<GameOutcome> GameExplicitRep::NewOutcomes(const std::vector<std::string> &p_labels)
+{
+  // Checking each label against all the outcomes in turn, as NewOutcome does, would be
+  // quadratic in the number of outcomes
+  std::set<std::string> labels;
+  for (const auto &outcome : m_outcomes) {
+    labels.insert(outcome->GetLabel());
+  }
+  for (const auto &label : p_labels) {
+    if (label.empty()) {
+      throw ValueException("Outcome label must not be empty");
+    }
+    CheckLabel(label);
+    if (!labels.insert(label).second) {
+      throw ValueException("Outcome label must be unique within the game");
+    }
+  }
+  std::vector<GameOutcome> outcomes;
+  outcomes.reserve(p_labels.size());
+  for (const auto &label : p_labels) {
+    m_outcomes.push_back(std::make_shared<GameOutcomeRep>(this, m_outcomes.size() + 1, label));
+    outcomes.emplace_back(m_outcomes.back());
+  }
+  return outcomes;
+}
+
 //------------------------------------------------------------------------
 //                GameExplicitRep: Writing data files
 //------------------------------------------------------------------------
@@ -43,6 +43,8 @@ public:
   //@{
   /// Creates a new outcome in the game
   GameOutcome NewOutcome(const std::string &p_label) override;
+  /// Creates a new outcome in the game with each of the labels
+  std::vector<GameOutcome> NewOutcomes(const std::vector<std::string> &p_labels) override;
 
   /// @name Writing data files
   //@{
@@ -20,10 +20,15 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <iterator>
+#include <set>
 
 #include "games.h"
 #include "gametable.h"
+#include "tensor.h"
 #include "writer.h"
 
 namespace Gambit {
@@ -66,7 +71,11 @@ GameOutcome TablePureStrategyProfileRep::GetOutcome() const
 
 void TablePureStrategyProfileRep::SetOutcome(GameOutcome p_outcome)
 {
-  dynamic_cast<GameTableRep &>(*m_game).m_results[m_index] = p_outcome.get();
+  auto &game = dynamic_cast<GameTableRep &>(*m_game);
+  if (const auto newOutcome = p_outcome.get(); newOutcome != game.m_results[m_index]) {
+    game.m_results[m_index] = newOutcome;
+    game.IncrementVersion();
+  }
 }
 
 Rational TablePureStrategyProfileRep::GetPayoff(const GamePlayer &p_player) const
@@ -102,177 +111,11 @@ PureStrategyProfile GameTableRep::NewPureStrategyProfile() const
 //                   TableMixedStrategyProfileRep<T>
 //========================================================================
 
-template <class T> class ProductDistribution {
-public:
-  using index_type = long;
-  using prob_type = T;
-  using value_type = std::pair<index_type, prob_type>;
-
-  class iterator {
-  public:
-    using iterator_category = std::forward_iterator_tag;
-    using difference_type = std::ptrdiff_t;
-    using value_type = std::pair<index_type, prob_type>;
-    using reference = value_type;
-    using pointer = void;
-
-    iterator() = default;
-
-    iterator(const SegmentedVector<T> &probs, const SegmentedArray<long> &offsets, size_t skip1,
-             size_t skip2, bool end)
-      : m_probs(&probs), m_offsets(&offsets), m_done(end)
-    {
-      if (m_done) {
-        return;
-      }
-
-      const size_t P = m_probs->GetShape().size();
-
-      // Build active dimension list
-      for (size_t p = 1; p <= P; ++p) {
-        if (p != skip1 && p != skip2) {
-          m_dims.push_back(p);
-        }
-      }
-
-      m_K = m_dims.size();
-
-      m_digit.assign(m_K, 0);
-      m_radix.assign(m_K, 0);
-      m_cum_prob.assign(m_K + 1, T{});
-
-      // initialise radices
-      for (size_t j = 0; j < m_K; ++j) {
-        const size_t p = m_dims[j];
-        m_radix[j] = m_probs->segment(p).size();
-        if (m_radix[j] == 0) {
-          m_done = true;
-          return;
-        }
-      }
-
-      // initial recompute
-      recompute_from(0);
-      advance_to_next_nonzero();
-    }
-
-    reference operator*() const { return {m_index, m_cum_prob[m_K]}; }
-
-    iterator &operator++()
-    {
-      if (m_done) {
-        return *this;
-      }
-
-      // increment odometer
-      size_t j = 0;
-      for (; j < m_K; ++j) {
-        if (++m_digit[j] < m_radix[j]) {
-          break;
-        }
-        m_digit[j] = 0;
-      }
-
-      if (j == m_K) {
-        m_done = true;
-        return *this;
-      }
-
-      recompute_from(j);
-      advance_to_next_nonzero();
-      return *this;
-    }
-
-    iterator operator++(int)
-    {
-      iterator tmp = *this;
-      ++(*this);
-      return tmp;
-    }
-
-    bool operator==(const iterator &other) const { return m_done == other.m_done; }
-
-  private:
-    void recompute_from(size_t j0)
-    {
-      m_index = 0;
-      m_cum_prob[0] = T{1};
-
-      for (size_t j = 0; j < m_K; ++j) {
-        const size_t p = m_dims[j];
-        const size_t d = m_digit[j] + 1;
-
-        const T pi = m_probs->segment(p)[d];
-        m_cum_prob[j + 1] = m_cum_prob[j] * pi;
-        m_index += m_offsets->segment(p)[d];
-      }
-    }
-
-    void advance_to_next_nonzero()
-    {
-      while (!m_done && m_cum_prob[m_K] == T{0}) {
-        size_t j = 0;
-        for (; j < m_K; ++j) {
-          if (++m_digit[j] < m_radix[j]) {
-            break;
-          }
-          m_digit[j] = 0;
-        }
-
-        if (j == m_K) {
-          m_done = true;
-          return;
-        }
-
-        recompute_from(j);
-      }
-    }
-
-    const SegmentedVector<T> *m_probs{nullptr};
-    const SegmentedArray<long> *m_offsets{nullptr};
-
-    std::vector<size_t> m_dims; // active player numbers
-    size_t m_K{0};
-    bool m_done{true};
-
-    std::vector<size_t> m_digit;
-    std::vector<size_t> m_radix;
-    std::vector<T> m_cum_prob;
-    index_type m_index{0};
-  };
-
-  ProductDistribution(const SegmentedVector<T> &probs, const SegmentedArray<long> &offsets)
-    : m_probs(probs), m_offsets(offsets), m_skip1(0), m_skip2(0)
-  {
-  }
-
-  ProductDistribution(const SegmentedVector<T> &probs, const SegmentedArray<long> &offsets,
-                      size_t skip1)
-    : m_probs(probs), m_offsets(offsets), m_skip1(skip1), m_skip2(0)
-  {
-  }
-
-  ProductDistribution(const SegmentedVector<T> &probs, const SegmentedArray<long> &offsets,
-                      size_t skip1, size_t skip2)
-    : m_probs(probs), m_offsets(offsets), m_skip1(skip1), m_skip2(skip2)
-  {
-  }
-
-  iterator begin() const { return iterator(m_probs, m_offsets, m_skip1, m_skip2, false); }
-
-  iterator end() const { return iterator(m_probs, m_offsets, m_skip1, m_skip2, true); }
-
-private:
-  const SegmentedVector<T> &m_probs;
-  const SegmentedArray<long> &m_offsets;
-  size_t m_skip1;
-  size_t m_skip2;
-};
-
 template <class T> class TableMixedStrategyProfileRep : public MixedStrategyProfileRep<T> {
 public:
   explicit TableMixedStrategyProfileRep(const StrategySupportProfile &p_support)
-    : MixedStrategyProfileRep<T>(p_support)
+    : MixedStrategyProfileRep<T>(p_support),
+      m_contraction(p_support.GetGame()->m_pureStrategies)
   {
   }
   ~TableMixedStrategyProfileRep() override = default;
@@ -282,6 +125,22 @@ public:
   T GetPayoffDeriv(int pl, const GameStrategy &) const override;
   bool GetPayoffDerivs(int pl, Vector<T> &p_derivs) const override;
   T GetPayoffDeriv(int pl, const GameStrategy &, const GameStrategy &) const override;
+  void GetPayoffDerivs(Matrix<T> &p_derivs) const override;
+
+private:
+  /// Contracts the payoff tensors against the profile
+  mutable TensorContraction<T> m_contraction;
+  mutable bool m_weightsValid{false};
+  /// Contractions computed since the profile was last changed, indexed by the player
+  /// whose payoffs are contracted and the (0-based) modes kept
+  mutable std::map<std::pair<int, size_t>, std::vector<T>> m_values;
+  mutable std::map<std::tuple<int, size_t, size_t>, std::vector<T>> m_crossValues;
+
+  const T *GetPayoffTensor(int pl) const;
+  void UpdateWeights() const;
+  const std::vector<T> &GetValues(int pl, size_t p_mode) const;
+  const std::vector<T> &GetValues(int pl, size_t p_mode1, size_t p_mode2) const;
+  void OnProfileChanged() const override;
 };
 
 template <class T>
@@ -290,54 +149,93 @@ std::unique_ptr<MixedStrategyProfileRep<T>> TableMixedStrategyProfileRep<T>::Cop
   return std::make_unique<TableMixedStrategyProfileRep>(*this);
 }
 
-template <class T> T TableMixedStrategyProfileRep<T>::GetPayoff(int pl) const
+template <class T> void TableMixedStrategyProfileRep<T>::OnProfileChanged() const
 {
-  const auto game = this->GetSupport().GetGame();
-  auto &g = dynamic_cast<GameTableRep &>(*game);
-  const auto player = game->GetPlayer(pl);
-  T value{0};
-  for (auto [index, prob] : ProductDistribution<T>(this->m_probs, this->m_offsets)) {
-    if (const auto outcome = g.m_results[index]) {
-      value += prob * outcome->template GetPayoff<T>(player);
+  m_weightsValid = false;
+  m_values.clear();
+  m_crossValues.clear();
+}
+
+template <class T> const T *TableMixedStrategyProfileRep<T>::GetPayoffTensor(int pl) const
+{
+  const auto &g = dynamic_cast<const GameTableRep &>(*this->GetSupport().GetGame());
+  return g.template GetPayoffTensor<T>(pl).m_data.data();
+}
+
+template <class T> void TableMixedStrategyProfileRep<T>::UpdateWeights() const
+{
+  if (m_weightsValid) {
+    return;
+  }
+  const auto &strides = this->GetSupport().GetGame()->m_pureStrategies.m_strides;
+  for (size_t mode = 0; mode < m_contraction.NumModes(); ++mode) {
+    std::vector<T> weights(m_contraction.GetRadix(mode), T{0});
+    const auto offsets = this->m_offsets.segment(mode + 1);
+    const auto probs = this->m_probs.segment(mode + 1);
+    for (size_t i = 1; i <= offsets.size(); ++i) {
+      weights[offsets[i] / strides[mode]] = probs[i];
     }
+    m_contraction.SetWeights(mode, weights);
   }
-  return value;
+  m_weightsValid = true;
 }
 
+/// Returns the payoffs to player pl from each of the pure strategies at mode
+/// p_mode, against the profile
 template <class T>
-T TableMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, const GameStrategy &strategy) const
+const std::vector<T> &TableMixedStrategyProfileRep<T>::GetValues(int pl, size_t p_mode) const
+{
+  auto &values = m_values[{pl, p_mode}];
+  if (values.empty()) {
+    UpdateWeights();
+    values.resize(m_contraction.GetRadix(p_mode));
+    m_contraction.Contract(GetPayoffTensor(pl), p_mode, values.data());
+  }
+  return values;
+}
+
+/// Returns the payoffs to player pl from each pair of pure strategies at modes
+/// p_mode1 and p_mode2, against the profile
+template <class T>
+const std::vector<T> &TableMixedStrategyProfileRep<T>::GetValues(int pl, size_t p_mode1,
+                                                                 size_t p_mode2) const
+{
+  auto &values = m_crossValues[{pl, p_mode1, p_mode2}];
+  if (values.empty()) {
+    UpdateWeights();
+    values.resize(m_contraction.GetRadix(p_mode1) * m_contraction.GetRadix(p_mode2));
+    m_contraction.Contract(GetPayoffTensor(pl), p_mode1, p_mode2, values.data());
+  }
+  return values;
+}
+
+template <class T> T TableMixedStrategyProfileRep<T>::GetPayoff(int pl) const
 {
-  const auto game = this->GetSupport().GetGame();
-  auto &g = dynamic_cast<GameTableRep &>(*game);
-  auto base_index = this->StrategyOffset(strategy);
-  const auto player = game->GetPlayer(pl);
+  const auto &values = GetValues(pl, pl - 1);
+  const auto offsets = this->m_offsets.segment(pl);
+  const auto probs = this->m_probs.segment(pl);
+  const auto stride = this->GetSupport().GetGame()->m_pureStrategies.m_strides[pl - 1];
   T value{0};
-  for (auto [index, prob] : ProductDistribution<T>(this->m_probs, this->m_offsets,
-                                                   strategy->GetPlayer()->GetNumber())) {
-    if (const auto outcome = g.m_results[base_index + index]) {
-      value += prob * outcome->template GetPayoff<T>(player);
-    }
+  for (size_t i = 1; i <= offsets.size(); ++i) {
+    value += probs[i] * values[offsets[i] / stride];
   }
   return value;
 }
 
+template <class T>
+T TableMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, const GameStrategy &strategy) const
+{
+  return GetValues(pl, strategy->GetPlayer()->GetNumber() - 1)[strategy->GetNumber() - 1];
+}
+
 template <class T>
 bool TableMixedStrategyProfileRep<T>::GetPayoffDerivs(int pl, Vector<T> &p_derivs) const
 {
-  const auto game = this->GetSupport().GetGame();
-  auto &g = dynamic_cast<GameTableRep &>(*game);
-  const auto player = game->GetPlayer(pl);
-  p_derivs = T{0};
-  auto segment = this->m_offsets.segment(pl);
-  for (auto [index, prob] : ProductDistribution<T>(this->m_probs, this->m_offsets, pl)) {
-    auto deriv_it = p_derivs.begin();
-    for (const auto base_index : segment) {
-      if (const auto outcome = g.m_results[base_index + index]) {
-        *deriv_it += prob * outcome->template GetPayoff<T>(player);
-        ++deriv_it;
-      }
-    }
-  }
+  const auto &values = GetValues(pl, pl - 1);
+  const auto offsets = this->m_offsets.segment(pl);
+  const auto stride = this->GetSupport().GetGame()->m_pureStrategies.m_strides[pl - 1];
+  std::transform(offsets.begin(), offsets.end(), p_derivs.begin(),
+                 [&](const long offset) { return values[offset / stride]; });
   return true;
 }
 
@@ -348,19 +246,53 @@ T TableMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, const GameStrategy &st
   if (strategy1->GetPlayer() == strategy2->GetPlayer()) {
     return T{0};
   }
-  const auto game = this->GetSupport().GetGame();
-  auto &g = dynamic_cast<GameTableRep &>(*game);
-  auto base_index = this->StrategyOffset(strategy1) + this->StrategyOffset(strategy2);
-  const auto player = game->GetPlayer(pl);
-  T value{0};
-  for (auto [index, prob] :
-       ProductDistribution<T>(this->m_probs, this->m_offsets, strategy1->GetPlayer()->GetNumber(),
-                              strategy2->GetPlayer()->GetNumber())) {
-    if (const auto outcome = g.m_results[base_index + index]) {
-      value += prob * outcome->template GetPayoff<T>(player);
+  const size_t mode1 = strategy1->GetPlayer()->GetNumber() - 1;
+  const size_t mode2 = strategy2->GetPlayer()->GetNumber() - 1;
+  if (mode1 > mode2) {
+    return GetPayoffDeriv(pl, strategy2, strategy1);
+  }
+  const auto &values = GetValues(pl, mode1, mode2);
+  return values[(strategy1->GetNumber() - 1) * m_contraction.GetRadix(mode2) +
+                strategy2->GetNumber() - 1];
+}
+
+template <class T>
+void TableMixedStrategyProfileRep<T>::GetPayoffDerivs(Matrix<T> &p_derivs) const
+{
+  UpdateWeights();
+  p_derivs = T{0};
+  const auto &support = this->GetSupport();
+  const size_t numModes = m_contraction.NumModes();
+  // Each player's rows are computed together, sharing contractions across players
+  std::vector<std::vector<T>> blocks(numModes);
+  std::vector<T *> results(numModes, nullptr);
+  for (const auto &player1 : support.GetPlayers()) {
+    const size_t mode1 = player1->GetNumber() - 1;
+    for (size_t mode2 = 0; mode2 < numModes; ++mode2) {
+      if (mode2 != mode1) {
+        blocks[mode2].resize(m_contraction.GetRadix(mode1) * m_contraction.GetRadix(mode2));
+        results[mode2] = blocks[mode2].data();
+      }
+      else {
+        results[mode2] = nullptr;
+      }
+    }
+    m_contraction.ContractPairs(GetPayoffTensor(player1->GetNumber()), mode1, results);
+    for (const auto &strategy1 : support.GetStrategies(player1)) {
+      const int row = this->m_profileIndex.at(strategy1);
+      for (const auto &player2 : support.GetPlayers()) {
+        const size_t mode2 = player2->GetNumber() - 1;
+        if (mode2 == mode1) {
+          continue;
+        }
+        const T *values = blocks[mode2].data() +
+                          (strategy1->GetNumber() - 1) * m_contraction.GetRadix(mode2) - 1;
+        for (const auto &strategy2 : support.GetStrategies(player2)) {
+          p_derivs(row, this->m_profileIndex.at(strategy2)) = values[strategy2->GetNumber()];
+        }
+      }
     }
   }
-  return value;
 }
 
 template class TableMixedStrategyProfileRep<double>;
@@ -441,6 +373,152 @@ Rational GameTableRep::GetPlayerMaxPayoff(const GamePlayer &p_player) const
   return maxpay;
 }
 
+template <>
+GameTableRep::PayoffTensors<double> &GameTableRep::GetPayoffTensors<double>() const
+{
+  return m_doublePayoffs;
+}
+
+template <>
+GameTableRep::PayoffTensors<Rational> &GameTableRep::GetPayoffTensors<Rational>() const
+{
+  return m_rationalPayoffs;
+}
+
+template <class T> const CartesianTensor<T> &GameTableRep::GetPayoffTensor(int p_player) const
+{
+  auto &cache = GetPayoffTensors<T>();
+  const std::lock_guard<std::mutex> lock(m_payoffTensorsMutex);
+  if (!cache.m_valid || cache.m_version != m_version) {
+    cache.m_tensors.resize(m_players.size());
+    for (auto &tensor : cache.m_tensors) {
+      tensor.m_space = &m_pureStrategies;
+      tensor.m_data.assign(m_results.size(), T{0});
+    }
+    for (size_t index = 0; index < m_results.size(); ++index) {
+      if (const auto outcome = m_results[index]) {
+        for (const auto &[player, payoff] : outcome->m_payoffs) {
+          cache.m_tensors[player->m_number - 1].m_data[index] = static_cast<const T &>(payoff);
+        }
+      }
+    }
+    cache.m_version = m_version;
+    cache.m_valid = true;
+  }
+  return cache.m_tensors.at(p_player - 1);
+}
+
+template const CartesianTensor<double> &GameTableRep::GetPayoffTensor<double>(int) const;
+template const CartesianTensor<Rational> &GameTableRep::GetPayoffTensor<Rational>(int) const;
+
+//------------------------------------------------------------------------
+//                  GameTableRep: Bulk access to payoffs
+//------------------------------------------------------------------------
+
+namespace {
+
+/// Returns the number written with the fewest decimal digits which reads back as
+/// p_value, as when a payoff is set from a floating-point value in pygambit.
+Number DoubleToNumber(double p_value)
+{
+  if (!std::isfinite(p_value)) {
+    throw ValueException("Payoffs must be finite");
+  }
+  return Number(DecimalText(p_value));
+}
+
+} // end anonymous namespace
+
+void GameTableRep::AssignPayoffs(int p_player, const std::function<Number(size_t)> &p_payoff)
+{
+  GamePlayerRep *player = GetPlayer(p_player).get();
+  // Outcomes created for contingencies which have none are labelled "_1", "_2", ...,
+  // as the labels of unlabelled outcomes are normalised when a game is read, skipping
+  // any of these already in use
+  std::set<std::string> used;
+  size_t lastLabel = 0;
+  for (size_t index = 0; index < m_results.size(); ++index) {
+    if (m_results[index] == nullptr) {
+      if (lastLabel == 0) {
+        std::transform(m_outcomes.begin(), m_outcomes.end(), std::inserter(used, used.end()),
+                       [](const std::shared_ptr<GameOutcomeRep> &c) { return c->m_label; });
+      }
+      std::string label;
+      do {
+        label = "_" + std::to_string(++lastLabel);
+      } while (used.contains(label));
+      m_outcomes.push_back(std::make_shared<GameOutcomeRep>(this, m_outcomes.size() + 1, label));
+      m_results[index] = m_outcomes.back().get();
+    }
+    m_results[index]->m_payoffs[player] = p_payoff(index);
+  }
+  IncrementVersion();
+}
+
+void GameTableRep::SetPayoffs(std::vector<Number> &&p_payoffs)
+{
+  const size_t numPlayers = m_players.size();
+  if (p_payoffs.size() != numPlayers * m_results.size()) {
+    throw DimensionException("Number of payoffs does not match the size of the game");
+  }
+  for (size_t pl = 0; pl < numPlayers; ++pl) {
+    AssignPayoffs(static_cast<int>(pl) + 1, [&p_payoffs, numPlayers, pl](size_t index) {
+      return std::move(p_payoffs[index * numPlayers + pl]);
+    });
+  }
+}
+
+void GameTableRep::SetPayoffs(int p_player, const double *p_payoffs)
+{
+  AssignPayoffs(p_player, [p_payoffs](size_t index) { return DoubleToNumber(p_payoffs[index]); });
+}
+
+void GameTableRep::SetPayoffs(int p_player, const std::int64_t *p_payoffs)
+{
+  AssignPayoffs(p_player,
+                [p_payoffs](size_t index) { return Number(std::to_string(p_payoffs[index])); });
+}
+
+std::vector<size_t> GameTableRep::GetOutcomeIndices() const
+{
+  std::vector<size_t> indices(m_results.size());
+  std::transform(m_results.begin(), m_results.end(), indices.begin(),
+                 [](const GameOutcomeRep *c) { return (c) ? c->m_number : 0; });
+  return indices;
+}
+
+void GameTableRep::SetOutcomeIndices(const std::vector<size_t> &p_indices)
+{
+  if (p_indices.size() != m_results.size()) {
+    throw DimensionException("Number of outcomes does not match the size of the game");
+  }
+  if (std::any_of(p_indices.begin(), p_indices.end(),
+                  [this](size_t index) { return index > m_outcomes.size(); })) {
+    throw std::out_of_range("Outcome index out of range");
+  }
+  std::transform(p_indices.begin(), p_indices.end(), m_results.begin(),
+                 [this](size_t index) { return (index) ? m_outcomes[index - 1].get() : nullptr; });
+  IncrementVersion();
+}
+
+void GameTableRep::GetPayoffs(int p_player, double *p_payoffs) const
+{
+  const auto &payoffs = GetPayoffTensor<double>(p_player).m_data;
+  std::copy(payoffs.begin(), payoffs.end(), p_payoffs);
+}
+
+void GameTableRep::GetPayoffs(int p_player, std::int64_t *p_payoffs) const
+{
+  const auto &payoffs = GetPayoffTensor<Rational>(p_player).m_data;
+  std::transform(payoffs.begin(), payoffs.end(), p_payoffs, [](const Rational &payoff) {
+    if (payoff.denominator() != Integer(1) || !payoff.numerator().fits_in_long()) {
+      throw ValueException("Payoff " + lexical_cast<std::string>(payoff) +
+                           " cannot be represented as a 64-bit integer");
+    }
+    return static_cast<std::int64_t>(payoff.numerator().as_long());
+  });
+}
+
 //------------------------------------------------------------------------
 //                   GameTableRep: Writing data files
 //------------------------------------------------------------------------
@@ -23,6 +23,10 @@
 #ifndef GAMBIT_GAMES_GAMETABLE_H
 #define GAMBIT_GAMES_GAMETABLE_H
 
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
 #include "gameexpl.h"
 
 namespace Gambit {
@@ -38,12 +42,26 @@ class GameTableRep : public GameExplicitRep {
 private:
   std::vector<GameOutcomeRep *> m_results;
 
+  /// Dense copies of the players' payoffs, in the same strategy-major order as m_results.
+  /// These are built on demand and rebuilt whenever the game version changes.
+  template <class T> struct PayoffTensors {
+    bool m_valid{false};
+    unsigned int m_version{0};
+    std::vector<CartesianTensor<T>> m_tensors;
+  };
+  mutable std::mutex m_payoffTensorsMutex;
+  mutable PayoffTensors<double> m_doublePayoffs;
+  mutable PayoffTensors<Rational> m_rationalPayoffs;
+
   /// @name Private auxiliary functions
   //@{
   /// Rebuild the outcome table after the strategies of p_player have changed.
   /// p_oldToNew maps old strategy indices to new index, or to -1 if the strategy was removed.
   void RebuildTable(const std::vector<long> &old_radices, long p_player,
                     const std::vector<long> &p_oldToNew);
+  template <class T> PayoffTensors<T> &GetPayoffTensors() const;
+  /// Sets the payoff to player number p_player at each contingency to p_payoff(index)
+  void AssignPayoffs(int p_player, const std::function<Number(size_t)> &p_payoff);
   //@}
 
 public:
@@ -66,6 +84,39 @@ public:
   Rational GetPlayerMaxPayoff(const GamePlayer &) const override;
 
   bool IsPerfectRecall() const override { return true; }
+
+  /// Returns the payoffs to player number p_player as a dense tensor over the pure
+  /// strategy profiles, in the same order as the outcome table.  Contingencies
+  /// with no outcome have payoff zero.  The reference remains valid until the
+  /// game is next modified.
+  template <class T> const CartesianTensor<T> &GetPayoffTensor(int p_player) const;
+  //@}
+
+  /// @name Bulk access to payoffs
+  //@{
+  /// Sets the payoffs to player number p_player from p_payoffs, which has an entry for
+  /// each pure strategy profile, in the same order as GetPayoffTensor.  Each payoff
+  /// is assigned to the outcome of its contingency, which is created if there is none;
+  /// where an outcome is shared by several contingencies, the last payoff assigned wins.
+  void SetPayoffs(int p_player, const double *p_payoffs);
+  void SetPayoffs(int p_player, const std::int64_t *p_payoffs);
+  /// Sets the payoffs to all players from p_payoffs, which lists the payoff to each
+  /// player in turn at each pure strategy profile, in the same order as GetPayoffTensor;
+  /// this is the order of the payoff format of .nfg files.  The payoffs are moved out of
+  /// p_payoffs.
+  void SetPayoffs(std::vector<Number> &&p_payoffs);
+  /// Returns the number of the outcome at each pure strategy profile, in the same order
+  /// as GetPayoffTensor, or zero where there is none
+  std::vector<size_t> GetOutcomeIndices() const;
+  /// Sets the outcome at each pure strategy profile from p_indices, which has an entry
+  /// for each in the same order as GetPayoffTensor: the number of the outcome, or zero
+  /// for none
+  void SetOutcomeIndices(const std::vector<size_t> &p_indices);
+  /// Writes the payoffs to player number p_player to p_payoffs, in the same order
+  /// as GetPayoffTensor.  Throws ValueException if p_payoffs is integer-valued and
+  /// a payoff is not an integer in its range.
+  void GetPayoffs(int p_player, double *p_payoffs) const;
+  void GetPayoffs(int p_player, std::int64_t *p_payoffs) const;
   //@}
 
   /// @name Dimensions of the game
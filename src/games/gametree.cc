@@ -26,6 +26,7 @@
 #include <limits>
 #include <numeric>
 #include <set>
+#include <iterator>
 #include <stack>
 #include <unordered_map>
 #include <unordered_set>
@@ -41,6 +42,145 @@ namespace Gambit {
 //                   class TreeMixedStrategyProfileRep
 //========================================================================
 
+namespace {
+
+/// Sums the values of pairs of sequences over the sequences consistent with each
+/// pair of strategies.  p_seqValues holds the value of sequence pair (a, b) at
+/// a * p_numSequences2 + b; the value of strategy pair (s1, s2) is returned at
+/// s1 * p_strategySeqs2.size() + s2.
+template <class T>
+std::vector<T> SumOverStrategies(const std::vector<T> &p_seqValues, size_t p_numSequences2,
+                                 const std::vector<std::vector<size_t>> &p_strategySeqs1,
+                                 const std::vector<std::vector<size_t>> &p_strategySeqs2)
+{
+  // Summing over the first player's sequences, then the second's, keeps the cost
+  // proportional to the number of strategy pairs
+  std::vector<T> partial(p_strategySeqs1.size() * p_numSequences2, T{0});
+  for (size_t s1 = 0; s1 < p_strategySeqs1.size(); ++s1) {
+    T *row = partial.data() + s1 * p_numSequences2;
+    for (const auto seq1 : p_strategySeqs1[s1]) {
+      const T *values = p_seqValues.data() + seq1 * p_numSequences2;
+      for (size_t seq2 = 0; seq2 < p_numSequences2; ++seq2) {
+        row[seq2] += values[seq2];
+      }
+    }
+  }
+  std::vector<T> values(p_strategySeqs1.size() * p_strategySeqs2.size());
+  auto value = values.begin();
+  for (size_t s1 = 0; s1 < p_strategySeqs1.size(); ++s1) {
+    const T *row = partial.data() + s1 * p_numSequences2;
+    for (const auto &seqs2 : p_strategySeqs2) {
+      *value++ = sum_function(seqs2, [row](const size_t seq2) -> T { return row[seq2]; });
+    }
+  }
+  return values;
+}
+
+} // end anonymous namespace
+
+/// The payoffs of a tree game are multilinear in the realization probabilities of the
+/// players' sequences.  The nodes with outcomes are aggregated according to the sequence
+/// of each player leading to them, weighting payoffs by the probabilities of the chance
+/// moves along the way.  A strategy is consistent with the sequences whose actions it
+/// chooses, and the realization probability of a sequence is the total probability of
+/// the strategies consistent with it.
+template <class T> struct TreeMixedStrategyProfileRep<T>::SequenceForm {
+  size_t m_numPlayers;
+  /// The number of sequences of each player; sequence 0 is the empty sequence
+  std::vector<size_t> m_numSequences;
+  /// The sequences consistent with each strategy of each player, in increasing order
+  std::vector<std::vector<std::vector<size_t>>> m_strategySequences;
+  /// The sequence of each player, and the payoff to each player, at each entry
+  std::vector<size_t> m_entrySequences;
+  std::vector<T> m_entryPayoffs;
+
+  explicit SequenceForm(const GameRep &);
+
+  size_t NumEntries() const
+  {
+    return (m_numPlayers == 0) ? 0 : m_entrySequences.size() / m_numPlayers;
+  }
+};
+
+template <class T>
+TreeMixedStrategyProfileRep<T>::SequenceForm::SequenceForm(const GameRep &p_game)
+  : m_numPlayers(p_game.NumPlayers()), m_numSequences(m_numPlayers),
+    m_strategySequences(m_numPlayers)
+{
+  struct Sequence {
+    size_t m_parent;
+    GameInfosetRep *m_infoset;
+    int m_action;
+  };
+  std::vector<std::vector<Sequence>> sequences(m_numPlayers, {{0, nullptr, 0}});
+  std::vector<std::map<GameActionRep *, size_t>> sequenceIndex(m_numPlayers);
+  std::map<std::vector<size_t>, std::vector<T>> entries;
+
+  // The sequences and chance probability on reaching each node are set by its parent
+  std::vector<size_t> nodeSequences(p_game.NumNodes() * m_numPlayers, 0);
+  std::vector<T> nodeProbs(p_game.NumNodes(), T{0});
+  nodeProbs[p_game.GetRoot()->GetNumber() - 1] = T{1};
+  for (const auto &node : p_game.GetNodes()) {
+    const size_t index = node->GetNumber() - 1;
+    const T prob = nodeProbs[index];
+    if (prob == T{0}) {
+      continue;
+    }
+    const auto first = nodeSequences.begin() + index * m_numPlayers;
+    const std::vector<size_t> seqs(first, first + m_numPlayers);
+    if (const auto outcome = node->GetOutcome()) {
+      auto &payoffs = entries.try_emplace(seqs, m_numPlayers, T{0}).first->second;
+      for (const auto &player : p_game.GetPlayers()) {
+        payoffs[player->GetNumber() - 1] += prob * outcome->GetPayoff<T>(player);
+      }
+    }
+    const auto infoset = node->GetInfoset();
+    for (auto [action, child] : node->GetActions()) {
+      const size_t childIndex = child->GetNumber() - 1;
+      std::copy(seqs.begin(), seqs.end(), nodeSequences.begin() + childIndex * m_numPlayers);
+      if (infoset->IsChanceInfoset()) {
+        nodeProbs[childIndex] = prob * static_cast<T>(infoset->GetActionProb(action));
+        continue;
+      }
+      nodeProbs[childIndex] = prob;
+      const size_t pl = infoset->GetPlayer()->GetNumber() - 1;
+      const auto [seq, added] = sequenceIndex[pl].try_emplace(action.get(), sequences[pl].size());
+      if (added) {
+        sequences[pl].push_back({seqs[pl], infoset.get(), action->GetNumber()});
+      }
+      nodeSequences[childIndex * m_numPlayers + pl] = seq->second;
+    }
+  }
+
+  for (const auto &player : p_game.GetPlayers()) {
+    const size_t pl = player->GetNumber() - 1;
+    m_numSequences[pl] = sequences[pl].size();
+    m_strategySequences[pl].resize(player->GetStrategies().size());
+    for (const auto &strategy : player->GetStrategies()) {
+      // Sequences are numbered after their parents, so consistency with the parent
+      // is known when each sequence is reached
+      std::vector<bool> consistent(sequences[pl].size(), false);
+      consistent[0] = true;
+      auto &strategySeqs = m_strategySequences[pl][strategy->GetNumber() - 1];
+      strategySeqs.push_back(0);
+      for (size_t seq = 1; seq < sequences[pl].size(); ++seq) {
+        const auto &sequence = sequences[pl][seq];
+        const auto choice = strategy->m_behav.find(sequence.m_infoset);
+        if (consistent[sequence.m_parent] && choice != strategy->m_behav.end() &&
+            choice->second == sequence.m_action) {
+          consistent[seq] = true;
+          strategySeqs.push_back(seq);
+        }
+      }
+    }
+  }
+
+  for (const auto &[seqs, payoffs] : entries) {
+    m_entrySequences.insert(m_entrySequences.end(), seqs.begin(), seqs.end());
+    m_entryPayoffs.insert(m_entryPayoffs.end(), payoffs.begin(), payoffs.end());
+  }
+}
+
 //========================================================================
 //                   TreeMixedStrategyProfileRep<T>
 //========================================================================
@@ -58,30 +198,131 @@ std::unique_ptr<MixedStrategyProfileRep<T>> TreeMixedStrategyProfileRep<T>::Copy
   return std::make_unique<TreeMixedStrategyProfileRep>(*this);
 }
 
-template <class T> void TreeMixedStrategyProfileRep<T>::MakeBehavior() const
+template <class T> void TreeMixedStrategyProfileRep<T>::OnProfileChanged() const
+{
+  m_realizValid = false;
+  m_values.clear();
+  m_crossValues.clear();
+}
+
+template <class T>
+const typename TreeMixedStrategyProfileRep<T>::SequenceForm &
+TreeMixedStrategyProfileRep<T>::GetSequenceForm() const
 {
-  if (m_mixedBehavior == nullptr) {
-    m_mixedBehavior = std::make_shared<MixedBehaviorProfile<T>>(MixedStrategyProfile<T>(Copy()));
+  if (!m_sequenceForm) {
+    m_sequenceForm = std::make_shared<const SequenceForm>(*this->GetSupport().GetGame());
   }
+  return *m_sequenceForm;
 }
 
-template <class T> void TreeMixedStrategyProfileRep<T>::OnProfileChanged() const
+template <class T> void TreeMixedStrategyProfileRep<T>::ComputeRealizProbs() const
 {
-  m_mixedBehavior = nullptr;
+  if (m_realizValid) {
+    return;
+  }
+  const auto &seqForm = GetSequenceForm();
+  m_realizProbs.resize(seqForm.m_numPlayers);
+  for (const auto &player : this->GetSupport().GetPlayers()) {
+    const size_t pl = player->GetNumber() - 1;
+    auto &probs = m_realizProbs[pl];
+    probs.assign(seqForm.m_numSequences[pl], T{0});
+    for (const auto &strategy : this->GetSupport().GetStrategies(player)) {
+      const T &prob = (*this)[strategy];
+      for (const auto seq : seqForm.m_strategySequences[pl][strategy->GetNumber() - 1]) {
+        probs[seq] += prob;
+      }
+    }
+  }
+  m_realizValid = true;
+}
+
+/// Returns the payoffs to player pl from each of the pure strategies of the
+/// (0-based) player p_player, against the profile
+template <class T>
+const std::vector<T> &TreeMixedStrategyProfileRep<T>::GetValues(int pl, size_t p_player) const
+{
+  auto &values = m_values[{pl, p_player}];
+  if (values.empty()) {
+    ComputeRealizProbs();
+    const auto &seqForm = GetSequenceForm();
+    const size_t numPlayers = seqForm.m_numPlayers;
+    std::vector<T> seqValues(seqForm.m_numSequences[p_player], T{0});
+    for (size_t entry = 0; entry < seqForm.NumEntries(); ++entry) {
+      const size_t *seqs = seqForm.m_entrySequences.data() + entry * numPlayers;
+      T weight = seqForm.m_entryPayoffs[entry * numPlayers + pl - 1];
+      for (size_t i = 0; i < numPlayers && weight != T{0}; ++i) {
+        if (i != p_player) {
+          weight *= m_realizProbs[i][seqs[i]];
+        }
+      }
+      if (weight != T{0}) {
+        seqValues[seqs[p_player]] += weight;
+      }
+    }
+    // The values are computed as those of pairs of strategies, the first of which is
+    // consistent only with the empty sequence of a notional player
+    const std::vector<std::vector<size_t>> emptySequence(1, std::vector<size_t>(1, 0));
+    values = SumOverStrategies(seqValues, seqValues.size(), emptySequence,
+                               seqForm.m_strategySequences[p_player]);
+  }
+  return values;
+}
+
+/// Returns the payoffs to player pl from each pair of pure strategies of the
+/// (0-based) players p_player1 and p_player2, against the profile
+template <class T>
+const std::vector<T> &TreeMixedStrategyProfileRep<T>::GetValues(int pl, size_t p_player1,
+                                                                size_t p_player2) const
+{
+  auto &values = m_crossValues[{pl, p_player1, p_player2}];
+  if (values.empty()) {
+    ComputeRealizProbs();
+    const auto &seqForm = GetSequenceForm();
+    const size_t numPlayers = seqForm.m_numPlayers;
+    const size_t numSequences2 = seqForm.m_numSequences[p_player2];
+    std::vector<T> seqValues(seqForm.m_numSequences[p_player1] * numSequences2, T{0});
+    for (size_t entry = 0; entry < seqForm.NumEntries(); ++entry) {
+      const size_t *seqs = seqForm.m_entrySequences.data() + entry * numPlayers;
+      T weight = seqForm.m_entryPayoffs[entry * numPlayers + pl - 1];
+      for (size_t i = 0; i < numPlayers && weight != T{0}; ++i) {
+        if (i != p_player1 && i != p_player2) {
+          weight *= m_realizProbs[i][seqs[i]];
+        }
+      }
+      if (weight != T{0}) {
+        seqValues[seqs[p_player1] * numSequences2 + seqs[p_player2]] += weight;
+      }
+    }
+    values = SumOverStrategies(seqValues, numSequences2, seqForm.m_strategySequences[p_player1],
+                               seqForm.m_strategySequences[p_player2]);
+  }
+  return values;
 }
 
 template <class T> T TreeMixedStrategyProfileRep<T>::GetPayoff(int pl) const
 {
-  MakeBehavior();
-  return m_mixedBehavior->GetPayoff(m_mixedBehavior->GetGame()->GetPlayer(pl));
+  const auto &values = GetValues(pl, pl - 1);
+  const auto &player = this->GetSupport().GetGame()->GetPlayer(pl);
+  return sum_function(this->GetSupport().GetStrategies(player), [&](const auto &strategy) -> T {
+    return (*this)[strategy] * values[strategy->GetNumber() - 1];
+  });
 }
 
 template <class T>
 T TreeMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, const GameStrategy &strategy) const
 {
-  TreeMixedStrategyProfileRep tmp(*this);
-  tmp.SetStrategy(strategy);
-  return tmp.GetPayoff(pl);
+  return GetValues(pl, strategy->GetPlayer()->GetNumber() - 1)[strategy->GetNumber() - 1];
+}
+
+template <class T>
+bool TreeMixedStrategyProfileRep<T>::GetPayoffDerivs(int pl, Vector<T> &p_derivs) const
+{
+  const auto &values = GetValues(pl, pl - 1);
+  const auto &player = this->GetSupport().GetGame()->GetPlayer(pl);
+  const auto &strategies = this->GetSupport().GetStrategies(player);
+  std::transform(strategies.begin(), strategies.end(), p_derivs.begin(),
+                 [&](const auto &strategy) { return values[strategy->GetNumber() - 1]; });
+  return true;
 }
 
 template <class T>
@@ -89,12 +330,84 @@ T TreeMixedStrategyProfileRep<T>::GetPayoffDeriv(int pl, const GameStrategy &str
                                                  const GameStrategy &strategy2) const
 {
   if (strategy1->GetPlayer() == strategy2->GetPlayer()) {
-    return static_cast<T>(0);
+    return T{0};
+  }
+  const size_t player1 = strategy1->GetPlayer()->GetNumber() - 1;
+  const size_t player2 = strategy2->GetPlayer()->GetNumber() - 1;
+  if (player1 > player2) {
+    return GetPayoffDeriv(pl, strategy2, strategy1);
+  }
+  const auto &values = GetValues(pl, player1, player2);
+  return values[(strategy1->GetNumber() - 1) * strategy2->GetPlayer()->GetStrategies().size() +
+                strategy2->GetNumber() - 1];
+}
+
+template <class T>
+void TreeMixedStrategyProfileRep<T>::GetPayoffDerivs(Matrix<T> &p_derivs) const
+{
+  ComputeRealizProbs();
+  const auto &seqForm = GetSequenceForm();
+  const size_t numPlayers = seqForm.m_numPlayers;
+  // The values of each pair of sequences for each ordered pair of players are accumulated
+  // in a single pass over the entries, from the payoffs to the first player of the pair
+  std::vector<std::vector<T>> seqValues(numPlayers * numPlayers);
+  for (size_t pl1 = 0; pl1 < numPlayers; ++pl1) {
+    for (size_t pl2 = 0; pl2 < numPlayers; ++pl2) {
+      if (pl1 != pl2) {
+        seqValues[pl1 * numPlayers + pl2].assign(
+            seqForm.m_numSequences[pl1] * seqForm.m_numSequences[pl2], T{0});
+      }
+    }
+  }
+  std::vector<T> probs(numPlayers);
+  for (size_t entry = 0; entry < seqForm.NumEntries(); ++entry) {
+    const size_t *seqs = seqForm.m_entrySequences.data() + entry * numPlayers;
+    const T *payoffs = seqForm.m_entryPayoffs.data() + entry * numPlayers;
+    for (size_t i = 0; i < numPlayers; ++i) {
+      probs[i] = m_realizProbs[i][seqs[i]];
+    }
+    for (size_t pl1 = 0; pl1 < numPlayers; ++pl1) {
+      if (payoffs[pl1] == T{0}) {
+        continue;
+      }
+      for (size_t pl2 = 0; pl2 < numPlayers; ++pl2) {
+        if (pl2 == pl1) {
+          continue;
+        }
+        T weight = payoffs[pl1];
+        for (size_t i = 0; i < numPlayers; ++i) {
+          if (i != pl1 && i != pl2) {
+            weight *= probs[i];
+          }
+        }
+        seqValues[pl1 * numPlayers + pl2][seqs[pl1] * seqForm.m_numSequences[pl2] + seqs[pl2]] +=
+            weight;
+      }
+    }
+  }
+
+  p_derivs = T{0};
+  const auto &support = this->GetSupport();
+  for (const auto &player1 : support.GetPlayers()) {
+    const size_t pl1 = player1->GetNumber() - 1;
+    for (const auto &player2 : support.GetPlayers()) {
+      const size_t pl2 = player2->GetNumber() - 1;
+      if (pl2 == pl1) {
+        continue;
+      }
+      const auto values = SumOverStrategies(
+          seqValues[pl1 * numPlayers + pl2], seqForm.m_numSequences[pl2],
+          seqForm.m_strategySequences[pl1], seqForm.m_strategySequences[pl2]);
+      const size_t numStrategies2 = seqForm.m_strategySequences[pl2].size();
+      for (const auto &strategy1 : support.GetStrategies(player1)) {
+        const int row = this->m_profileIndex.at(strategy1);
+        const T *rowValues = values.data() + (strategy1->GetNumber() - 1) * numStrategies2 - 1;
+        for (const auto &strategy2 : support.GetStrategies(player2)) {
+          p_derivs(row, this->m_profileIndex.at(strategy2)) = rowValues[strategy2->GetNumber()];
+        }
+      }
+    }
   }
-  TreeMixedStrategyProfileRep tmp(*this);
-  tmp.SetStrategy(strategy1);
-  tmp.SetStrategy(strategy2);
-  return tmp.GetPayoff(pl);
 }
 
 template class TreeMixedStrategyProfileRep<double>;
@@ -915,6 +1228,18 @@ GameTreeRep::GameTreeRep()
 
 GameTreeRep::~GameTreeRep()
 {
+  // Each node owns its children, so releasing the root would destroy the tree recursively.
+  // Detaching the children of every node first releases the nodes one at a time, so that
+  // destroying a deep tree does not exhaust the stack.
+  std::vector<std::shared_ptr<GameNodeRep>> nodes{m_root};
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    auto &children = nodes[i]->m_children;
+    for (auto &child : children) {
+      child->Invalidate();
+      nodes.push_back(std::move(child));
+    }
+    children.clear();
+  }
   m_root->Invalidate();
   m_chance->Invalidate();
 }
@@ -927,6 +1252,113 @@ Game GameTreeRep::Copy() const
   return ReadGame(is);
 }
 
+void GameTreeRep::BuildTree(const Layout &p_layout)
+{
+  if (!m_root->m_children.empty()) {
+    throw UndefinedException("A tree can only be built in place of a trivial tree");
+  }
+  std::set<std::pair<size_t, std::string>> infosetLabels;
+  for (const auto &infoset : p_layout.m_infosets) {
+    if (infoset.m_player > m_players.size()) {
+      throw std::out_of_range("Player index out of range");
+    }
+    if (infoset.m_actions.empty()) {
+      throw UndefinedException("An information set must have at least one action");
+    }
+    for (const auto &label : infoset.m_actions) {
+      CheckLabel(label);
+    }
+    if (infoset.m_player == 0) {
+      if (infoset.m_actions.size() != infoset.m_probs.size()) {
+        throw DimensionException(
+            "The number of probabilities given must match the number of actions");
+      }
+      ValidateDistribution(infoset.m_probs);
+    }
+    CheckLabel(infoset.m_label);
+    if (!infoset.m_label.empty() &&
+        !infosetLabels.emplace(infoset.m_player, infoset.m_label).second) {
+      throw ValueException("Infoset label must be unique for the player");
+    }
+  }
+
+  // In preorder, each node fills the next open position below a node already listed, and
+  // each nonterminal node opens a position for each of its actions.  The layout describes
+  // a tree exactly when there is an open position for every node, and none is left over.
+  std::unordered_set<std::string> nodeLabels;
+  std::vector<bool> infosetUsed(p_layout.m_infosets.size(), false);
+  size_t openPositions = 1;
+  for (const auto &node : p_layout.m_nodes) {
+    if (openPositions == 0) {
+      throw DimensionException("The layout has more nodes than the tree has positions");
+    }
+    --openPositions;
+    if (node.m_infoset > p_layout.m_infosets.size()) {
+      throw std::out_of_range("Information set index out of range");
+    }
+    if (node.m_outcome > m_outcomes.size()) {
+      throw std::out_of_range("Outcome index out of range");
+    }
+    if (node.m_infoset > 0) {
+      openPositions += p_layout.m_infosets[node.m_infoset - 1].m_actions.size();
+      infosetUsed[node.m_infoset - 1] = true;
+    }
+    CheckLabel(node.m_label);
+    if (!node.m_label.empty() && !nodeLabels.insert(node.m_label).second) {
+      throw ValueException("Node label must be unique within the game");
+    }
+  }
+  if (openPositions > 0) {
+    throw DimensionException("The layout has fewer nodes than the tree has positions");
+  }
+  if (std::find(infosetUsed.begin(), infosetUsed.end(), false) != infosetUsed.end()) {
+    throw ValueException("Every information set must contain at least one node");
+  }
+
+  IncrementVersion();
+  std::vector<GameInfosetRep *> infosets;
+  infosets.reserve(p_layout.m_infosets.size());
+  for (const auto &infoset : p_layout.m_infosets) {
+    auto *player =
+        (infoset.m_player == 0) ? m_chance.get() : m_players[infoset.m_player - 1].get();
+    auto newInfoset = std::make_shared<GameInfosetRep>(
+        this, player->m_infosets.size() + 1, player, static_cast<int>(infoset.m_actions.size()));
+    newInfoset->m_label = infoset.m_label;
+    auto label_it = infoset.m_actions.begin();
+    for (const auto &action : newInfoset->m_actions) {
+      action->m_label = *label_it++;
+    }
+    if (player->IsChance()) {
+      std::copy(infoset.m_probs.begin(), infoset.m_probs.end(), newInfoset->m_probs.begin());
+    }
+    infosets.push_back(newInfoset.get());
+    player->m_infosets.push_back(newInfoset);
+  }
+
+  // The positions still to be filled, with the next one to be filled on top
+  std::vector<std::shared_ptr<GameNodeRep>> positions{m_root};
+  for (const auto &node : p_layout.m_nodes) {
+    const auto rep = std::move(positions.back());
+    positions.pop_back();
+    rep->m_label = node.m_label;
+    if (node.m_outcome > 0) {
+      rep->m_outcome = m_outcomes[node.m_outcome - 1].get();
+    }
+    if (node.m_infoset > 0) {
+      rep->m_infoset = infosets[node.m_infoset - 1];
+      rep->m_infoset->m_members.push_back(rep);
+      for (size_t i = 0; i < rep->m_infoset->m_actions.size(); ++i) {
+        rep->m_children.push_back(std::make_shared<GameNodeRep>(this, rep.get()));
+      }
+      positions.insert(positions.end(), rep->m_children.rbegin(), rep->m_children.rend());
+      m_numNonterminalNodes++;
+    }
+  }
+  m_numNodes = p_layout.m_nodes.size();
+  ClearComputedValues();
+  InvalidateTreeOrdering();
+}
+
 Game NewTree(const std::vector<std::string> &p_players)
 {
   auto game = std::make_shared<GameTreeRep>();
@@ -1188,35 +1620,32 @@ void GameTreeRep::EnsureStrategies() const
   });
 }
 
-void GameTreeRep::BuildSequences(const GameNode &n, PureSequenceProfile &p_currentSequences) const
+void GameTreeRep::BuildSequences(
+    const GameNode &n, PureSequenceProfile &p_currentSequences,
+    std::unordered_map<GameActionRep *, std::shared_ptr<GameSequenceRep>> &p_actionSequences)
+    const
 {
   if (!n->GetInfoset()) {
     return;
   }
   if (n->GetPlayer()->IsChance()) {
     for (auto child : n->GetChildren()) {
-      BuildSequences(child, p_currentSequences);
+      BuildSequences(child, p_currentSequences, p_actionSequences);
     }
   }
   else {
     auto *player = n->m_infoset->m_player;
     const auto tmp_sequence = p_currentSequences.GetSequence(n->GetPlayer());
     for (const auto &action : n->m_infoset->m_actions) {
-      auto seq_it =
-          std::find_if(player->m_sequences.begin(), player->m_sequences.end(),
-                       [&action](const auto seq) { return seq->m_action == action.get(); });
-      std::shared_ptr<GameSequenceRep> sequence;
-      if (seq_it == player->m_sequences.end()) {
+      auto &sequence = p_actionSequences[action.get()];
+      if (!sequence) {
         player->m_sequences.emplace_back(std::make_shared<GameSequenceRep>(
             n->m_infoset->m_player, action.get(), player->m_sequences.size() + 1,
             tmp_sequence.get_shared()));
         sequence = player->m_sequences.back();
       }
-      else {
-        sequence = *seq_it;
-      }
       p_currentSequences.SetSequence(sequence);
-      BuildSequences(n->GetChild(action), p_currentSequences);
+      BuildSequences(n->GetChild(action), p_currentSequences, p_actionSequences);
     }
     p_currentSequences.SetSequence(tmp_sequence);
   }
@@ -1231,7 +1660,9 @@ void GameTreeRep::EnsureSequences() const
                                                                std::weak_ptr<GameSequenceRep>())};
       currentSequences.SetSequence(player->m_sequences.front());
     }
-    BuildSequences(m_root, currentSequences);
+    // Each action begins exactly one sequence; the map finds it without scanning the list
+    std::unordered_map<GameActionRep *, std::shared_ptr<GameSequenceRep>> actionSequences;
+    BuildSequences(m_root, currentSequences, actionSequences);
   });
 }
 
@@ -1633,7 +2064,7 @@ std::vector<GameSubgame> GameTreeRep::GetSubgames() const
 
 namespace {
 
-void WriteEfgFile(std::ostream &f, const GameNode &n)
+void WriteEfgNode(std::ostream &f, const GameNode &n)
 {
   if (n->IsTerminal()) {
     f << "t ";
@@ -1671,8 +2102,22 @@ void WriteEfgFile(std::ostream &f, const GameNode &n)
   else {
     f << "0" << std::endl;
   }
-  for (auto child : n->GetChildren()) {
-    WriteEfgFile(f, child);
+}
+
+void WriteEfgFile(std::ostream &f, const GameNode &p_subtree)
+{
+  // The nodes are written in preorder using an explicit stack, so that the depth of the
+  // tree is not limited by the depth of the call stack
+  std::stack<GameNode> nodes;
+  nodes.push(p_subtree);
+  while (!nodes.empty()) {
+    const GameNode n = nodes.top();
+    nodes.pop();
+    WriteEfgNode(f, n);
+    const auto children = n->GetChildren();
+    std::for_each(std::make_reverse_iterator(children.end()),
+                  std::make_reverse_iterator(children.begin()),
+                  [&nodes](const GameNode &child) { nodes.push(child); });
   }
 }
 
@@ -87,7 +87,10 @@ protected:
   void ClearComputedValues() const;
 
   void EnsureSequences() const override;
-  void BuildSequences(const GameNode &n, PureSequenceProfile &p_currentSequences) const;
+  void BuildSequences(
+      const GameNode &n, PureSequenceProfile &p_currentSequences,
+      std::unordered_map<GameActionRep *, std::shared_ptr<GameSequenceRep>> &p_actionSequences)
+      const;
 
   /// Removes the node from the information set, invalidating if emptied
   void RemoveMember(GameInfosetRep *, GameNodeRep *);
@@ -96,11 +99,42 @@ protected:
   //@}
 
 public:
+  /// A flat description of the structure of a game tree, from which BuildTree constructs
+  /// the tree in a single step
+  struct Layout {
+    /// An information set, given by the number of its player (0 for chance), its label,
+    /// the labels of its actions, and (for chance) the probabilities of the actions
+    struct Infoset {
+      size_t m_player{0};
+      std::string m_label;
+      std::vector<std::string> m_actions;
+      std::vector<Number> m_probs;
+    };
+    /// A node, given by the index of its information set (from 1, or 0 for a terminal
+    /// node), the number of its outcome (0 for none), and its label
+    struct Node {
+      size_t m_infoset{0};
+      size_t m_outcome{0};
+      std::string m_label;
+    };
+
+    std::vector<Infoset> m_infosets;
+    /// The nodes of the tree in preorder; the children of a node are its successors
+    /// in the order of the actions of its information set
+    std::vector<Node> m_nodes;
+  };
+
   /// @name Lifecycle
   //@{
   GameTreeRep();
   ~GameTreeRep() override;
   Game Copy() const override;
+
+  /// Builds the tree described by p_layout, which must be a valid tree referring only to
+  /// the existing players and outcomes, in place of the trivial tree of a new game.
+  /// This is equivalent to building the tree by AppendMove and AppendEvent, but its cost
+  /// is linear in the size of the tree, and its depth is limited only by memory.
+  void BuildTree(const Layout &p_layout);
   //@}
 
   /// @name General data access
@@ -228,12 +262,27 @@ public:
   std::unique_ptr<MixedStrategyProfileRep<T>> Copy() const override;
   T GetPayoff(int pl) const override;
   T GetPayoffDeriv(int pl, const GameStrategy &) const override;
+  bool GetPayoffDerivs(int pl, Vector<T> &p_derivs) const override;
   T GetPayoffDeriv(int pl, const GameStrategy &, const GameStrategy &) const override;
+  void GetPayoffDerivs(Matrix<T> &p_derivs) const override;
 
 private:
-  mutable std::shared_ptr<MixedBehaviorProfile<T>> m_mixedBehavior;
-
-  void MakeBehavior() const;
+  /// The payoffs of the game in terms of the players' sequences, which depend only on
+  /// the game, and so are shared among copies of the profile
+  struct SequenceForm;
+  mutable std::shared_ptr<const SequenceForm> m_sequenceForm;
+  /// The realization probabilities of each player's sequences under the profile
+  mutable std::vector<std::vector<T>> m_realizProbs;
+  mutable bool m_realizValid{false};
+  /// Payoffs computed since the profile was last changed, indexed by the player
+  /// whose payoffs are computed and the (0-based) players whose strategies are fixed
+  mutable std::map<std::pair<int, size_t>, std::vector<T>> m_values;
+  mutable std::map<std::tuple<int, size_t, size_t>, std::vector<T>> m_crossValues;
+
+  const SequenceForm &GetSequenceForm() const;
+  void ComputeRealizProbs() const;
+  const std::vector<T> &GetValues(int pl, size_t p_player) const;
+  const std::vector<T> &GetValues(int pl, size_t p_player1, size_t p_player2) const;
   void OnProfileChanged() const override;
 };
 
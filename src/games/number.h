@@ -23,6 +23,7 @@
 #ifndef GAMBIT_GAMES_NUMBER_H
 #define GAMBIT_GAMES_NUMBER_H
 
+#include <charconv>
 #include <string>
 #include <ostream>
 #include "core/util.h"
@@ -66,9 +67,12 @@ public:
       m_double(static_cast<double>(p_rational))
   {
   }
+  Number(const Number &) = default;
+  Number(Number &&) = default;
   ~Number() = default;
 
   Number &operator=(const Number &p_number) = default;
+  Number &operator=(Number &&p_number) = default;
   Number &operator=(const std::string &p_text)
   {
     // We call lexical_cast<Rational>() first because it throws a ValueException
@@ -93,6 +97,22 @@ public:
   friend std::ostream &operator<<(std::ostream &s, const Number &n) { return s << n.m_text; }
 };
 
+/// Returns the text with the fewest decimal digits which reads back as the finite value
+/// p_value.  The text always has a decimal point, so that a number constructed from it
+/// is reported as a decimal.
+inline std::string DecimalText(double p_value)
+{
+  // The longest fixed-point representation of a double is somewhat over 320 characters
+  char buffer[512];
+  const auto end =
+      std::to_chars(buffer, buffer + sizeof(buffer), p_value, std::chars_format::fixed).ptr;
+  std::string text(buffer, end);
+  if (text.find('.') == std::string::npos) {
+    text += ".0";
+  }
+  return text;
+}
+
 } // namespace Gambit
 
 #endif // GAMBIT_GAMES_NUMBER_H
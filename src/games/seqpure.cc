@@ -21,6 +21,7 @@
 //
 
 #include <stack>
+#include <unordered_map>
 
 #include "games.h"
 
@@ -207,6 +208,75 @@ Rational PureSequenceProfile::GetRealizationProbability() const
   return total;
 }
 
+std::vector<SequenceFormEntry> GetSequenceFormEntries(const Game &p_game)
+{
+  const size_t numPlayers = p_game->NumPlayers();
+  std::unordered_map<const GameActionRep *, GameSequence> actionSequences;
+  std::vector<GameSequence> rootSequences;
+  for (const auto &player : p_game->GetPlayers()) {
+    for (const auto &sequence : player->GetSequences()) {
+      if (const auto action = sequence->GetAction()) {
+        actionSequences.emplace(action.get(), sequence);
+      }
+      else {
+        rootSequences.push_back(sequence);
+      }
+    }
+  }
+
+  // The sequences, the probability of the chance moves, and the total payoffs from the
+  // outcomes on the path to each node are set when its parent is visited
+  const size_t numNodes = p_game->NumNodes();
+  std::vector<GameSequence> nodeSequences(numNodes * numPlayers);
+  std::vector<Rational> nodeProbs(numNodes), nodePayoffs(numNodes * numPlayers);
+  std::copy(rootSequences.begin(), rootSequences.end(), nodeSequences.begin());
+  nodeProbs[0] = Rational(1);
+
+  std::vector<SequenceFormEntry> entries;
+  std::map<std::vector<GameSequence>, size_t> entryIndex;
+  for (const auto &node : p_game->GetNodes()) {
+    const size_t index = node->GetNumber() - 1;
+    const auto sequences = nodeSequences.begin() + index * numPlayers;
+    const auto payoffs = nodePayoffs.begin() + index * numPlayers;
+    if (const auto outcome = node->GetOutcome()) {
+      for (const auto &player : p_game->GetPlayers()) {
+        payoffs[player->GetNumber() - 1] += outcome->GetPayoff<Rational>(player);
+      }
+    }
+    const Rational &prob = nodeProbs[index];
+
+    if (node->IsTerminal()) {
+      std::vector<GameSequence> key(sequences, sequences + numPlayers);
+      auto [entry, added] = entryIndex.try_emplace(std::move(key), entries.size());
+      if (added) {
+        entries.push_back({entry->first, Rational(0), std::vector<Rational>(numPlayers)});
+      }
+      auto &data = entries[entry->second];
+      data.m_probability += prob;
+      for (size_t pl = 0; pl < numPlayers; ++pl) {
+        data.m_payoffs[pl] += prob * payoffs[pl];
+      }
+      continue;
+    }
+
+    const auto infoset = node->GetInfoset();
+    for (auto [action, child] : node->GetActions()) {
+      const size_t childIndex = child->GetNumber() - 1;
+      std::copy(sequences, sequences + numPlayers,
+                nodeSequences.begin() + childIndex * numPlayers);
+      std::copy(payoffs, payoffs + numPlayers, nodePayoffs.begin() + childIndex * numPlayers);
+      if (infoset->IsChanceInfoset()) {
+        nodeProbs[childIndex] = prob * static_cast<Rational>(infoset->GetActionProb(action));
+        continue;
+      }
+      nodeProbs[childIndex] = prob;
+      nodeSequences[childIndex * numPlayers + infoset->GetPlayer()->GetNumber() - 1] =
+          actionSequences.at(action.get());
+    }
+  }
+  return entries;
+}
+
 SequenceContingencies::iterator::iterator(const Game &p_efg,
                                           const std::shared_ptr<SequenceMap> p_sequences,
                                           bool p_end)
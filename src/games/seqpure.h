@@ -83,6 +83,25 @@ public:
   Rational GetRealizationProbability() const;
 };
 
+/// A combination of one sequence for each player which is realised at some terminal node
+/// of a game, with the probability, over chance's moves alone, that the game terminates
+/// with each player having realised exactly their sequence in the combination, and the
+/// expected payoff to each player from those terminations.  Sequences and payoffs are
+/// listed in the order of the players.  These are the quantities computed for a single
+/// profile by PureSequenceProfile::GetRealizationProbability() and GetPayoff().
+struct SequenceFormEntry {
+  std::vector<GameSequence> m_sequences;
+  Rational m_probability;
+  std::vector<Rational> m_payoffs;
+};
+
+/// Returns the sequence form of the game as a sparse list of entries, one for each
+/// combination of sequences which is realised at some terminal node, in order of the
+/// first such node; all other combinations have zero probability and payoffs.
+/// The entries are accumulated in a single pass over the nodes of the tree, rather than
+/// a traversal for each combination, as iterating over GetSequenceContingencies() would.
+std::vector<SequenceFormEntry> GetSequenceFormEntries(const Game &p_game);
+
 /// The sequences of each player under consideration: e.g. those consistent
 /// with a support (BehaviorSupportProfile::GetSequenceMap()), or all of a
 /// player's sequences (GameRep::GetSequenceContingencies()).
@@ -0,0 +1,348 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/games/stratdom.cc
+// Testing dominance among the strategies of a player
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "gambit.h"
+#include "gametable.h"
+#include "stratdom.h"
+
+namespace Gambit {
+
+namespace {
+
+/// Compares the ranks in p_row against those in p_other over p_count entries, a block
+/// at a time.  Returns the index of the first entry at which p_row is less than (or,
+/// if p_strict, no greater than) p_other, or p_count if there is none; in that case,
+/// p_greater is set if p_row is greater than p_other at some entry.
+size_t FindViolation(const std::int32_t *p_row, const std::int32_t *p_other, size_t p_count,
+                     bool p_strict, size_t p_blockSize, bool &p_greater)
+{
+  p_greater = false;
+  for (size_t start = 0; start < p_count; start += p_blockSize) {
+    const size_t end = std::min(p_count, start + p_blockSize);
+    // Branch-free accumulation over the block allows the comparisons to be vectorised
+    int violated = 0, greater = 0;
+    if (p_strict) {
+      for (size_t i = start; i < end; ++i) {
+        violated |= (p_row[i] <= p_other[i]);
+      }
+    }
+    else {
+      for (size_t i = start; i < end; ++i) {
+        violated |= (p_row[i] < p_other[i]);
+        greater |= (p_row[i] > p_other[i]);
+      }
+    }
+    if (violated) {
+      for (size_t i = start; i < end; ++i) {
+        if (p_row[i] < p_other[i] || (p_strict && p_row[i] == p_other[i])) {
+          return i;
+        }
+      }
+    }
+    p_greater = p_greater || greater;
+  }
+  return p_count;
+}
+
+/// Sets p_ranks[i] to the rank of *p_payoffs[i] among the distinct payoffs.  The payoffs
+/// are sorted by their approximations p_approx; only runs of payoffs whose approximations
+/// are too close to be relied upon are ordered by comparing the payoffs exactly.
+void RankPayoffs(const std::vector<const Rational *> &p_payoffs,
+                 const std::vector<double> &p_approx, std::vector<std::int32_t> &p_ranks)
+{
+  constexpr double tolerance = 1.0e-9;
+  std::vector<size_t> order(p_payoffs.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&p_approx](size_t a, size_t b) { return p_approx[a] < p_approx[b]; });
+  p_ranks.resize(p_payoffs.size());
+  std::int32_t rank = -1;
+  for (auto run = order.begin(); run != order.end();) {
+    auto end = std::next(run);
+    while (end != order.end() &&
+           (p_approx[*end] == p_approx[*std::prev(end)] ||
+            p_approx[*end] - p_approx[*std::prev(end)] <=
+                tolerance * std::max(1.0, std::abs(p_approx[*end])))) {
+      ++end;
+    }
+    const Rational &first = *p_payoffs[*run];
+    if (std::any_of(std::next(run), end, [&](size_t i) { return *p_payoffs[i] != first; })) {
+      std::sort(run, end,
+                [&p_payoffs](size_t a, size_t b) { return *p_payoffs[a] < *p_payoffs[b]; });
+      for (auto it = run; it != end; ++it) {
+        if (it == run || *p_payoffs[*it] != *p_payoffs[*std::prev(it)]) {
+          ++rank;
+        }
+        p_ranks[*it] = rank;
+      }
+    }
+    else {
+      ++rank;
+      std::for_each(run, end, [&p_ranks, rank](size_t i) { p_ranks[i] = rank; });
+    }
+    run = end;
+  }
+}
+
+} // end anonymous namespace
+
+//========================================================================
+//                       class StrategyDominance
+//========================================================================
+
+StrategyDominance::StrategyDominance(const StrategySupportProfile &p_support,
+                                     const GamePlayer &p_player)
+  : m_player(p_player), m_numStrategies(p_player->GetStrategies().size())
+{
+  const Game game = p_support.GetGame();
+  if (p_player->GetGame() != game) {
+    throw MismatchException();
+  }
+  size_t stride = 1;
+  for (const auto &player : game->GetPlayers()) {
+    if (player == p_player) {
+      continue;
+    }
+    m_opponents.push_back(player->GetNumber() - 1);
+    m_digits.emplace_back();
+    for (const auto &strategy : p_support.GetStrategies(player)) {
+      m_digits.back().push_back(strategy->GetNumber() - 1);
+    }
+    m_radices.push_back(m_digits.back().size());
+    m_strides.push_back(stride);
+    stride *= m_radices.back();
+  }
+  m_numColumns = stride;
+
+  // Tabulate the payoffs, with the strategies of the opponents in each column
+  // given by the digits of the column index.
+  // Payoffs of table games are read from the game's payoff tables; others are computed.
+  std::vector<const Rational *> payoffs(m_numStrategies * m_numColumns);
+  std::vector<double> approx(payoffs.size());
+  std::vector<Rational> computed;
+  std::vector<size_t> position(m_opponents.size(), 0);
+  if (const auto *table = dynamic_cast<const GameTableRep *>(game.get())) {
+    const auto &tensor = table->GetPayoffTensor<Rational>(p_player->GetNumber()).m_data;
+    const auto &doubles = table->GetPayoffTensor<double>(p_player->GetNumber()).m_data;
+    std::vector<size_t> gameStrides(game->NumPlayers());
+    size_t gameStride = 1;
+    for (const auto &player : game->GetPlayers()) {
+      gameStrides[player->GetNumber() - 1] = gameStride;
+      gameStride *= player->GetStrategies().size();
+    }
+    const size_t playerStride = gameStrides[p_player->GetNumber() - 1];
+    for (size_t col = 0; col < m_numColumns; ++col) {
+      size_t index = 0;
+      for (size_t k = 0; k < m_opponents.size(); ++k) {
+        index += m_digits[k][position[k]] * gameStrides[m_opponents[k]];
+      }
+      for (size_t st = 0; st < m_numStrategies; ++st) {
+        payoffs[st * m_numColumns + col] = &tensor[index + st * playerStride];
+        approx[st * m_numColumns + col] = doubles[index + st * playerStride];
+      }
+      for (size_t k = 0; k < position.size() && ++position[k] == m_radices[k]; ++k) {
+        position[k] = 0;
+      }
+    }
+  }
+  else if (!game->IsTree() || game->IsPerfectRecall()) {
+    // The payoffs to all the player's strategies against a profile of the other players
+    // are computed together, as the derivatives of the payoff of a mixed profile.
+    computed.resize(payoffs.size());
+    auto profile = game->NewMixedStrategyProfile(Rational(0));
+    for (const auto &player : game->GetPlayers()) {
+      for (const auto &strategy : player->GetStrategies()) {
+        profile[strategy] = Rational(0);
+      }
+    }
+    const auto strategies = p_player->GetStrategies();
+    std::vector<GameStrategy> played(m_opponents.size());
+    for (size_t col = 0; col < m_numColumns; ++col) {
+      for (size_t k = 0; k < m_opponents.size(); ++k) {
+        const auto strategy =
+            game->GetPlayer(m_opponents[k] + 1)->GetStrategy(m_digits[k][position[k]] + 1);
+        if (strategy != played[k]) {
+          if (played[k]) {
+            profile[played[k]] = Rational(0);
+          }
+          profile[strategy] = Rational(1);
+          played[k] = strategy;
+        }
+      }
+      size_t st = 0;
+      for (const auto &strategy : strategies) {
+        computed[st++ * m_numColumns + col] =
+            profile.GetPayoffDeriv(p_player->GetNumber(), strategy);
+      }
+      for (size_t k = 0; k < position.size() && ++position[k] == m_radices[k]; ++k) {
+        position[k] = 0;
+      }
+    }
+  }
+  else {
+    computed.resize(payoffs.size());
+    auto profile = game->NewPureStrategyProfile();
+    const auto strategies = p_player->GetStrategies();
+    for (size_t col = 0; col < m_numColumns; ++col) {
+      for (size_t k = 0; k < m_opponents.size(); ++k) {
+        const auto opponent = game->GetPlayer(m_opponents[k] + 1);
+        profile->SetStrategy(opponent->GetStrategy(m_digits[k][position[k]] + 1));
+      }
+      size_t st = 0;
+      for (const auto &strategy : strategies) {
+        profile->SetStrategy(strategy);
+        computed[st++ * m_numColumns + col] = profile->GetPayoff(p_player);
+      }
+      for (size_t k = 0; k < position.size() && ++position[k] == m_radices[k]; ++k) {
+        position[k] = 0;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < computed.size(); ++i) {
+    payoffs[i] = &computed[i];
+    approx[i] = static_cast<double>(computed[i]);
+  }
+  RankPayoffs(payoffs, approx, m_ranks);
+
+  m_allowed.resize(m_opponents.size());
+  for (size_t k = 0; k < m_opponents.size(); ++k) {
+    m_allowed[k].assign(m_radices[k], 1);
+  }
+  m_columns.resize(m_numColumns);
+  std::iota(m_columns.begin(), m_columns.end(), 0);
+  m_weakWitness.assign(m_numStrategies * m_numStrategies, NoWitness);
+  m_strictWitness.assign(m_numStrategies * m_numStrategies, NoWitness);
+}
+
+void StrategyDominance::Restrict(const StrategySupportProfile &p_support)
+{
+  const Game game = p_support.GetGame();
+  if (game != m_player->GetGame()) {
+    throw MismatchException();
+  }
+  for (size_t k = 0; k < m_opponents.size(); ++k) {
+    const auto player = game->GetPlayer(m_opponents[k] + 1);
+    for (size_t pos = 0; pos < m_radices[k]; ++pos) {
+      m_allowed[k][pos] = p_support.Contains(player->GetStrategy(m_digits[k][pos] + 1));
+    }
+  }
+
+  m_columns.clear();
+  for (size_t col = 0; col < m_numColumns; ++col) {
+    if (IsAllowed(col)) {
+      m_columns.push_back(col);
+    }
+  }
+  m_restrictedValid = false;
+}
+
+size_t StrategyDominance::GetRow(const GameStrategy &p_strategy) const
+{
+  if (p_strategy->GetPlayer() != m_player) {
+    throw MismatchException();
+  }
+  return p_strategy->GetNumber() - 1;
+}
+
+bool StrategyDominance::IsAllowed(std::int64_t p_column) const
+{
+  for (size_t k = 0; k < m_opponents.size(); ++k) {
+    if (!m_allowed[k][(p_column / m_strides[k]) % m_radices[k]]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+const std::int32_t *StrategyDominance::GetRestrictedRow(size_t p_row) const
+{
+  if (m_columns.size() == m_numColumns) {
+    return m_ranks.data() + p_row * m_numColumns;
+  }
+  if (!m_restrictedValid) {
+    const size_t numColumns = m_columns.size();
+    m_restricted.resize(m_numStrategies * numColumns);
+    for (size_t row = 0; row < m_numStrategies; ++row) {
+      const auto *ranks = m_ranks.data() + row * m_numColumns;
+      auto *restricted = m_restricted.data() + row * numColumns;
+      for (size_t j = 0; j < numColumns; ++j) {
+        restricted[j] = ranks[m_columns[j]];
+      }
+    }
+    m_restrictedValid = true;
+  }
+  return m_restricted.data() + p_row * m_columns.size();
+}
+
+bool StrategyDominance::TestPair(size_t p_row, size_t p_other, bool p_strict) const
+{
+  auto &witness = (p_strict ? m_strictWitness : m_weakWitness)[p_row * m_numStrategies + p_other];
+  if (witness != NoWitness && IsAllowed(witness)) {
+    return false;
+  }
+  bool greater;
+  const size_t violation = FindViolation(GetRestrictedRow(p_row), GetRestrictedRow(p_other),
+                                         m_columns.size(), p_strict, BlockSize, greater);
+  if (violation < m_columns.size()) {
+    witness = m_columns[violation];
+    return false;
+  }
+  witness = NoWitness;
+  return p_strict || greater;
+}
+
+bool StrategyDominance::Dominates(const GameStrategy &p_strategy, const GameStrategy &p_other,
+                                  bool p_strict) const
+{
+  return TestPair(GetRow(p_strategy), GetRow(p_other), p_strict);
+}
+
+bool StrategyDominance::IsDominated(const GameStrategy &p_strategy,
+                                    const std::vector<GameStrategy> &p_candidates,
+                                    bool p_strict) const
+{
+  const size_t row = GetRow(p_strategy);
+  return std::any_of(p_candidates.begin(), p_candidates.end(),
+                     [this, row, p_strict](const GameStrategy &candidate) {
+                       const size_t other = GetRow(candidate);
+                       return other != row && TestPair(other, row, p_strict);
+                     });
+}
+
+std::vector<GameStrategy>
+StrategyDominance::GetDominated(const std::vector<GameStrategy> &p_candidates,
+                                bool p_strict) const
+{
+  std::vector<GameStrategy> dominated;
+  std::copy_if(p_candidates.begin(), p_candidates.end(), std::back_inserter(dominated),
+               [this, &p_candidates, p_strict](const GameStrategy &strategy) {
+                 return IsDominated(strategy, p_candidates, p_strict);
+               });
+  return dominated;
+}
+
+} // end namespace Gambit
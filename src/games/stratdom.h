@@ -0,0 +1,108 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/games/stratdom.h
+// Testing dominance among the strategies of a player
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_GAMES_STRATDOM_H
+#define GAMBIT_GAMES_STRATDOM_H
+
+#include <cstdint>
+
+#include "stratspt.h"
+
+namespace Gambit {
+
+/// @brief Tests for dominance among the strategies of a player.
+///
+/// On construction, the payoffs to the player of each of their strategies against
+/// each profile of strategies of the other players in a support profile are tabulated.
+/// Payoffs are stored by their rank among the distinct payoffs to the player, so
+/// comparisons are exact while being done on integers, a contiguous block at a time.
+///
+/// Tests may then be made against the profiles of any smaller support profile, by
+/// calling Restrict().  When a strategy is found not to dominate another, the profile
+/// of the other players at which this is seen is remembered.  Later tests of the pair
+/// are answered from this without a pass over the table, as long as that profile remains
+/// in the support; so, when a support is shrunk step by step, only the pairs whose
+/// remembered profiles have been removed are tested again.
+class StrategyDominance {
+public:
+  /// @name Lifecycle
+  //@{
+  /// Tabulates the payoffs to p_player against the profiles in p_support.  All the
+  /// player's strategies are tabulated, whether or not they are in the support.
+  StrategyDominance(const StrategySupportProfile &p_support, const GamePlayer &p_player);
+  //@}
+
+  /// @name Identification of dominated strategies
+  //@{
+  /// Restricts tests to the profiles of the other players in p_support, which
+  /// must be contained in the support the payoffs were tabulated against.
+  void Restrict(const StrategySupportProfile &p_support);
+
+  /// Returns true if p_strategy dominates p_other against the profiles of the
+  /// other players; if p_strict, dominance must be strict.
+  bool Dominates(const GameStrategy &p_strategy, const GameStrategy &p_other,
+                 bool p_strict) const;
+  /// Returns true if p_strategy is dominated by one of p_candidates
+  bool IsDominated(const GameStrategy &p_strategy, const std::vector<GameStrategy> &p_candidates,
+                   bool p_strict) const;
+  /// Returns the members of p_candidates which are dominated by another member
+  std::vector<GameStrategy> GetDominated(const std::vector<GameStrategy> &p_candidates,
+                                         bool p_strict) const;
+  //@}
+
+private:
+  /// Ranks are compared over blocks of this many profiles between tests for an early exit
+  static constexpr size_t BlockSize = 64;
+  /// Marks a pair of strategies for which no profile witnessing non-dominance is known
+  static constexpr std::int64_t NoWitness = -1;
+
+  GamePlayer m_player;
+  size_t m_numStrategies;
+  /// The other players, their numbers of strategies in the tabulated support, and the
+  /// stride of each in the column index of a profile
+  std::vector<size_t> m_opponents, m_radices, m_strides;
+  /// The number of the strategy in each position of the tabulated support of each opponent
+  std::vector<std::vector<int>> m_digits;
+  /// Rank of the payoff of each strategy (row) against each profile (column), row-major
+  std::vector<std::int32_t> m_ranks;
+  size_t m_numColumns;
+
+  /// Whether each tabulated strategy of each opponent is in the current restriction
+  std::vector<std::vector<char>> m_allowed;
+  /// Columns of the profiles in the current restriction
+  std::vector<size_t> m_columns;
+  /// The ranks restricted to m_columns, row-major; gathered on first use
+  mutable std::vector<std::int32_t> m_restricted;
+  mutable bool m_restrictedValid{false};
+  /// For each pair of strategies (row-major by dominating strategy), a column at which
+  /// weak and strict dominance respectively were last seen to fail
+  mutable std::vector<std::int64_t> m_weakWitness, m_strictWitness;
+
+  size_t GetRow(const GameStrategy &) const;
+  bool IsAllowed(std::int64_t p_column) const;
+  const std::int32_t *GetRestrictedRow(size_t p_row) const;
+  bool TestPair(size_t p_row, size_t p_other, bool p_strict) const;
+};
+
+} // end namespace Gambit
+
+#endif // GAMBIT_GAMES_STRATDOM_H
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "core/vector.h"
+#include "core/matrix.h"
 #include "core/segment.h"
 #include "games/game.h"
 #include "games/stratspt.h"
@@ -106,6 +107,7 @@ public:
   virtual T GetPayoffDeriv(int pl, const GameStrategy &) const = 0;
   virtual bool GetPayoffDerivs(int pl, Vector<T> &p_derivs) const { return false; }
   virtual T GetPayoffDeriv(int pl, const GameStrategy &, const GameStrategy &) const = 0;
+  virtual void GetPayoffDerivs(Matrix<T> &p_derivs) const;
 
   T GetPayoff(const GamePlayer &p_player) const { return GetPayoff(p_player->GetNumber()); }
   T GetPayoff(const GameStrategy &p_strategy) const
@@ -305,6 +307,19 @@ public:
     return m_rep->GetPayoffDeriv(pl, s1, s2);
   }
 
+  /// \brief Computes the second derivatives of each player's payoff
+  ///
+  /// Sets the entry of p_derivs in the row of strategy s1 and the column of strategy s2
+  /// to GetPayoffDeriv(pl, s1, s2), where pl is the player who owns s1.  Rows and columns
+  /// are numbered as in the probability vector of the profile, and p_derivs must be
+  /// a square matrix of size MixedProfileLength().  Entries where s1 and s2 belong to
+  /// the same player are zero.
+  void GetPayoffDerivs(Matrix<T> &p_derivs) const
+  {
+    CheckVersion();
+    m_rep->GetPayoffDerivs(p_derivs);
+  }
+
   /// Computes the payoff to playing the pure strategy against the profile
   T GetPayoff(const GameStrategy &p_strategy) const
   {
@@ -25,6 +25,7 @@
 
 #include "games.h"
 #include "gametable.h"
+#include "stratdom.h"
 
 namespace Gambit {
 
@@ -169,9 +170,13 @@ bool StrategySupportProfile::RemoveStrategy(const GameStrategy &p_strategy)
 bool StrategySupportProfile::Dominates(const GameStrategy &s, const GameStrategy &t,
                                        bool p_strict) const
 {
+  if (s->GetPlayer() != t->GetPlayer()) {
+    throw MismatchException();
+  }
+  // A single comparison is made directly, as it can usually stop well before all
+  // profiles of the other players have been visited.
   bool equal = true;
-
-  for (const auto &iter : StrategyContingencies(*this)) {
+  for (const auto &iter : StrategyContingencies(RestrictTo(s))) {
     const Rational ap = iter->GetStrategyValue(s);
     const Rational bp = iter->GetStrategyValue(t);
     if (p_strict && ap <= bp) {
@@ -186,111 +191,41 @@ bool StrategySupportProfile::Dominates(const GameStrategy &s, const GameStrategy
       }
     }
   }
-
   return (p_strict || !equal);
 }
 
 bool StrategySupportProfile::IsDominated(const GameStrategy &s, bool p_strict,
                                          bool p_external) const
 {
+  const GamePlayer player = s->GetPlayer();
+  const StrategyDominance dominance(*this, player);
   if (p_external) {
-    for (auto strategy : s->GetPlayer()->GetStrategies()) {
-      if (strategy != s && Dominates(strategy, s, p_strict)) {
-        return true;
-      }
-    }
-    return false;
-  }
-  else {
-    for (auto strategy : GetStrategies(s->GetPlayer())) {
-      if (strategy != s && Dominates(strategy, s, p_strict)) {
-        return true;
-      }
-    }
-    return false;
-  }
-}
-
-namespace {
-
-/// @brief Sort a range by a partial ordering and indicate minimal elements
-///
-/// Sorts the range bracketed by `first` and `last` according to a partial ordering.
-/// The partial ordering is specified by `greater`, which should be a binary
-/// operation which returns `true` if the first argument is greater than the
-/// second argument in the partial ordering.
-///
-/// On termination, the range between `first` and `last` is sorted in decreasing
-/// order by the partial ordering, in the sense that, if x > y according to the
-/// partial ordering, then x will come before y in the sorted output.
-///
-/// By this convention the set of **minimal elements** will all appear at the end
-/// of the sorted output.  The function returns an iterator pointing to the first
-/// minimal element in the sorted range.
-template <class Iterator, class Comparator>
-Iterator find_minimal_elements(Iterator first, Iterator last, Comparator greater)
-{
-  auto min = first, dis = std::prev(last);
-  while (min <= dis) {
-    auto pp = std::adjacent_find(first, last, greater);
-    if (pp < min) {
-      dis--;
-    }
-    else {
-      std::iter_swap(dis, min);
-      auto inc = std::next(min);
-      while (inc <= dis) {
-        if (greater(*min, *dis)) {
-          dis--;
-        }
-        else if (greater(*dis, *min)) {
-          std::iter_swap(dis, min);
-          dis--;
-        }
-        else {
-          std::iter_swap(dis, inc);
-          inc++;
-        }
-      }
-      min++;
-    }
-  }
-  return min;
-}
-
-} // end anonymous namespace
-
-bool UndominatedForPlayer(const StrategySupportProfile &p_support,
-                          StrategySupportProfile &p_newSupport, const GamePlayer &p_player,
-                          bool p_strict, bool p_external)
-{
-  std::vector<GameStrategy> set((p_external) ? p_player->GetStrategies().size()
-                                             : p_support.GetStrategies(p_player).size());
-  if (p_external) {
-    auto strategies = p_player->GetStrategies();
-    std::copy(strategies.begin(), strategies.end(), set.begin());
+    auto strategies = player->GetStrategies();
+    return dominance.IsDominated(s, {strategies.begin(), strategies.end()}, p_strict);
   }
   else {
-    auto strategies = p_support.GetStrategies(p_player);
-    std::copy(strategies.begin(), strategies.end(), set.begin());
-  }
-  auto min =
-      find_minimal_elements(set.begin(), set.end(),
-                            [&p_support, p_strict](const GameStrategy &s, const GameStrategy &t) {
-                              return p_support.Dominates(s, t, p_strict);
-                            });
-
-  for (auto s = min; s != set.end(); s++) {
-    p_newSupport.RemoveStrategy(*s);
+    auto strategies = GetStrategies(player);
+    return dominance.IsDominated(s, {strategies.begin(), strategies.end()}, p_strict);
   }
-  return min != set.end();
 }
 
 StrategySupportProfile StrategySupportProfile::Undominated(bool p_strict, bool p_external) const
 {
   StrategySupportProfile newSupport(*this);
   for (auto player : m_game->GetPlayers()) {
-    UndominatedForPlayer(*this, newSupport, player, p_strict, p_external);
+    const StrategyDominance dominance(*this, player);
+    std::vector<GameStrategy> candidates;
+    if (p_external) {
+      auto strategies = player->GetStrategies();
+      candidates.assign(strategies.begin(), strategies.end());
+    }
+    else {
+      auto strategies = GetStrategies(player);
+      candidates.assign(strategies.begin(), strategies.end());
+    }
+    for (const auto &strategy : dominance.GetDominated(candidates, p_strict)) {
+      newSupport.RemoveStrategy(strategy);
+    }
   }
   return newSupport;
 }
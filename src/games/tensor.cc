@@ -0,0 +1,273 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/games/tensor.cc
+// Contraction of dense payoff tensors against product distributions
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include "gambit.h"
+#include "tensor.h"
+
+// GCC on x86-64 Linux can build each kernel for several instruction sets,
+// dispatching to the best one the processor supports when the program is loaded.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define GAMBIT_TENSOR_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define GAMBIT_TENSOR_KERNEL
+#endif
+
+namespace Gambit {
+
+//========================================================================
+//                   Kernels for double-precision tensors
+//========================================================================
+
+GAMBIT_TENSOR_KERNEL void TensorAxpy(double *y, const double &a, const double *x, size_t n)
+{
+  const double scale = a;
+  for (size_t i = 0; i < n; ++i) {
+    y[i] += scale * x[i];
+  }
+}
+
+GAMBIT_TENSOR_KERNEL double TensorDot(const double *x, const double *y, size_t n)
+{
+  // Independent partial sums allow the loop to be vectorised
+  constexpr size_t lanes = 8;
+  double partial[lanes] = {0.0};
+  size_t i = 0;
+  for (; i + lanes <= n; i += lanes) {
+    for (size_t j = 0; j < lanes; ++j) {
+      partial[j] += x[i + j] * y[i + j];
+    }
+  }
+  double value = 0.0;
+  for (; i < n; ++i) {
+    value += x[i] * y[i];
+  }
+  for (size_t j = 0; j < lanes; ++j) {
+    value += partial[j];
+  }
+  return value;
+}
+
+//========================================================================
+//                      class TensorContraction<T>
+//========================================================================
+
+template <class T>
+TensorContraction<T>::TensorContraction(const CartesianProductSpace &p_space)
+  : m_radices(p_space.m_radices.begin(), p_space.m_radices.end()),
+    m_strides(p_space.m_strides.begin(), p_space.m_strides.end()), m_weights(m_radices.size()),
+    m_buffers(m_radices.size()), m_prefixes(m_radices.size() + 1),
+    m_prefixValid(m_radices.size() + 1, false)
+{
+  m_strides.push_back((m_radices.empty()) ? 1 : m_strides.back() * m_radices.back());
+  for (size_t mode = 0; mode < m_radices.size(); ++mode) {
+    m_weights[mode].assign(m_radices[mode], T{0});
+  }
+}
+
+template <class T>
+TensorContraction<T>::TensorContraction(const TensorContraction &p_other)
+  : m_radices(p_other.m_radices), m_strides(p_other.m_strides), m_weights(p_other.m_weights),
+    m_buffers(m_radices.size()), m_prefixes(m_radices.size() + 1),
+    m_prefixValid(m_radices.size() + 1, false)
+{
+}
+
+template <class T>
+TensorContraction<T> &TensorContraction<T>::operator=(const TensorContraction &p_other)
+{
+  if (this != &p_other) {
+    m_radices = p_other.m_radices;
+    m_strides = p_other.m_strides;
+    m_weights = p_other.m_weights;
+    m_buffers.assign(m_radices.size(), {});
+    m_prefixes.assign(m_radices.size() + 1, {});
+    m_prefixValid.assign(m_radices.size() + 1, false);
+  }
+  return *this;
+}
+
+template <class T>
+void TensorContraction<T>::SetWeights(size_t p_mode, const std::vector<T> &p_weights)
+{
+  if (p_weights.size() != m_radices.at(p_mode)) {
+    throw DimensionException();
+  }
+  m_weights[p_mode] = p_weights;
+  std::fill(m_prefixValid.begin() + p_mode + 1, m_prefixValid.end(), false);
+}
+
+/// Returns the outer product of the weights of the fastest-varying p_modes modes,
+/// laid out in the same way as the tensor.
+template <class T> const std::vector<T> &TensorContraction<T>::GetPrefix(size_t p_modes) const
+{
+  if (p_modes == 0) {
+    if (!m_prefixValid[0]) {
+      m_prefixes[0].assign(1, T{1});
+      m_prefixValid[0] = true;
+    }
+    return m_prefixes[0];
+  }
+  if (!m_prefixValid[p_modes]) {
+    const auto &inner = GetPrefix(p_modes - 1);
+    const auto &weights = m_weights[p_modes - 1];
+    auto &prefix = m_prefixes[p_modes];
+    prefix.resize(m_strides[p_modes]);
+    for (size_t s = 0; s < weights.size(); ++s) {
+      std::transform(inner.begin(), inner.end(), prefix.begin() + s * inner.size(),
+                     [&weight = weights[s]](const T &x) { return x * weight; });
+    }
+    m_prefixValid[p_modes] = true;
+  }
+  return m_prefixes[p_modes];
+}
+
+/// Contracts the slowest-varying mode p_mode of the tensor p_data, returning a
+/// pointer to the contracted tensor.
+template <class T>
+const T *TensorContraction<T>::ContractMode(const T *p_data, size_t p_mode) const
+{
+  const auto &weights = m_weights[p_mode];
+  const size_t block = m_strides[p_mode];
+  // A pure strategy selects a slice of the tensor, which needs no copying
+  const auto nonzero = std::count_if(weights.begin(), weights.end(),
+                                     [](const T &w) { return w != T{0}; });
+  if (nonzero == 1) {
+    const auto pure = std::find_if(weights.begin(), weights.end(),
+                                   [](const T &w) { return w != T{0}; });
+    if (*pure == T{1}) {
+      return p_data + (pure - weights.begin()) * block;
+    }
+  }
+  auto &buffer = m_buffers[p_mode];
+  buffer.assign(block, T{0});
+  for (size_t s = 0; s < weights.size(); ++s) {
+    if (weights[s] != T{0}) {
+      TensorAxpy(buffer.data(), weights[s], p_data + s * block, block);
+    }
+  }
+  return buffer.data();
+}
+
+/// Contracts the tensor p_data over its fastest-varying p_modes modes, keeping the
+/// modes listed in increasing order in p_keep.  The contraction of the slice where
+/// the kept modes take the values s_i is written to p_result[sum_i s_i * p_resultStrides[i]].
+template <class T>
+void TensorContraction<T>::Reduce(const T *p_data, size_t p_modes, const size_t *p_keep,
+                                  size_t p_numKeep, const size_t *p_resultStrides,
+                                  T *p_result) const
+{
+  const T *data = p_data;
+  size_t modes = p_modes;
+  while (modes > 0) {
+    const size_t mode = modes - 1;
+    if (p_numKeep > 0 && p_keep[p_numKeep - 1] == mode) {
+      for (size_t s = 0; s < m_radices[mode]; ++s) {
+        Reduce(data + s * m_strides[mode], mode, p_keep, p_numKeep - 1, p_resultStrides,
+               p_result + s * p_resultStrides[p_numKeep - 1]);
+      }
+      return;
+    }
+    if (p_numKeep == 0 && m_strides[mode] < MinimumBlockSize) {
+      break;
+    }
+    data = ContractMode(data, mode);
+    modes = mode;
+  }
+  *p_result = TensorDot(GetPrefix(modes).data(), data, m_strides[modes]);
+}
+
+template <class T> T TensorContraction<T>::Contract(const T *p_data) const
+{
+  T value{0};
+  Reduce(p_data, NumModes(), nullptr, 0, nullptr, &value);
+  return value;
+}
+
+template <class T>
+void TensorContraction<T>::Contract(const T *p_data, size_t p_keep, T *p_result) const
+{
+  const size_t keep[] = {p_keep};
+  const size_t strides[] = {1};
+  Reduce(p_data, NumModes(), keep, 1, strides, p_result);
+}
+
+template <class T>
+void TensorContraction<T>::Contract(const T *p_data, size_t p_keep1, size_t p_keep2,
+                                    T *p_result) const
+{
+  if (p_keep1 == p_keep2) {
+    throw ValueException("Modes to keep in a contraction must be distinct");
+  }
+  if (p_keep1 < p_keep2) {
+    const size_t keep[] = {p_keep1, p_keep2};
+    const size_t strides[] = {m_radices[p_keep2], 1};
+    Reduce(p_data, NumModes(), keep, 2, strides, p_result);
+  }
+  else {
+    const size_t keep[] = {p_keep2, p_keep1};
+    const size_t strides[] = {1, m_radices[p_keep2]};
+    Reduce(p_data, NumModes(), keep, 2, strides, p_result);
+  }
+}
+
+/// For each mode j below p_modes, contracts the tensor p_data over its fastest-varying
+/// p_modes modes keeping mode j, writing the result to row p_row of p_results[j].
+template <class T>
+void TensorContraction<T>::ReduceSingles(const T *p_data, size_t p_modes,
+                                         const std::vector<T *> &p_results, size_t p_row) const
+{
+  const size_t strides[] = {1};
+  const T *data = p_data;
+  for (size_t modes = p_modes; modes > 0; --modes) {
+    const size_t mode = modes - 1;
+    const size_t keep[] = {mode};
+    Reduce(data, modes, keep, 1, strides, p_results[mode] + p_row * m_radices[mode]);
+    data = ContractMode(data, mode);
+  }
+}
+
+template <class T>
+void TensorContraction<T>::ContractPairs(const T *p_data, size_t p_keep,
+                                         const std::vector<T *> &p_results) const
+{
+  if (p_results.size() != NumModes()) {
+    throw DimensionException();
+  }
+  // Modes above p_keep: each pair is computed from the tensor with all slower modes
+  // already contracted, after which that mode is contracted in turn.
+  const T *data = p_data;
+  for (size_t mode = NumModes() - 1; mode > p_keep; --mode) {
+    const size_t keep[] = {p_keep, mode};
+    const size_t strides[] = {m_radices[mode], 1};
+    Reduce(data, mode + 1, keep, 2, strides, p_results[mode]);
+    data = ContractMode(data, mode);
+  }
+  // Modes below p_keep: proceed in the same way within each slice of mode p_keep
+  for (size_t s = 0; s < m_radices[p_keep]; ++s) {
+    ReduceSingles(data + s * m_strides[p_keep], p_keep, p_results, s);
+  }
+}
+
+template class TensorContraction<double>;
+template class TensorContraction<Rational>;
+
+} // end namespace Gambit
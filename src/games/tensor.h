@@ -0,0 +1,118 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/games/tensor.h
+// Contraction of dense payoff tensors against product distributions
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_GAMES_TENSOR_H
+#define GAMBIT_GAMES_TENSOR_H
+
+#include <vector>
+
+#include "game.h"
+
+namespace Gambit {
+
+/// @name Kernels for tensor contraction
+//@{
+/// Computes y += a * x over n contiguous entries
+template <class T> void TensorAxpy(T *y, const T &a, const T *x, size_t n)
+{
+  for (size_t i = 0; i < n; ++i) {
+    y[i] += a * x[i];
+  }
+}
+/// Computes the inner product of n contiguous entries
+template <class T> T TensorDot(const T *x, const T *y, size_t n)
+{
+  T value{0};
+  for (size_t i = 0; i < n; ++i) {
+    if (x[i] != T{0}) {
+      value += x[i] * y[i];
+    }
+  }
+  return value;
+}
+/// Vectorised versions of the kernels.  Where the compiler supports it, these are built
+/// for several instruction sets, with the best available selected at runtime.
+void TensorAxpy(double *y, const double &a, const double *x, size_t n);
+double TensorDot(const double *x, const double *y, size_t n);
+//@}
+
+/// @brief Contracts a tensor over a space of pure strategy profiles against a
+///        product distribution over the factors of the space.
+///
+/// Tensors are laid out as in CartesianProductSpace, with the first mode varying
+/// fastest.  Modes are contracted one at a time, starting from the slowest-varying,
+/// so that each contraction step is a sequence of scaled additions of contiguous
+/// blocks, skipping strategies with zero weight.  Modes which are kept are split
+/// into slices, each of which is contracted in turn.  Once the remaining blocks
+/// become short, the fastest-varying modes are contracted in a single inner product
+/// against the outer product of their weights.
+///
+/// Intermediate results are kept in workspace buffers which are reused across calls;
+/// copying a contraction copies its weights but not its workspace.
+template <class T> class TensorContraction {
+public:
+  explicit TensorContraction(const CartesianProductSpace &p_space);
+  TensorContraction(const TensorContraction &);
+  TensorContraction &operator=(const TensorContraction &);
+  ~TensorContraction() = default;
+
+  /// Returns the number of modes of the tensors
+  size_t NumModes() const { return m_radices.size(); }
+  /// Returns the number of entries along mode p_mode (0-based)
+  size_t GetRadix(size_t p_mode) const { return m_radices[p_mode]; }
+
+  /// Sets the weights on the entries of mode p_mode (0-based)
+  void SetWeights(size_t p_mode, const std::vector<T> &p_weights);
+
+  /// Contracts all modes of the tensor
+  T Contract(const T *p_data) const;
+  /// Contracts all modes other than p_keep.  Entry s of p_result is the contraction
+  /// of the slice in which mode p_keep takes value s.
+  void Contract(const T *p_data, size_t p_keep, T *p_result) const;
+  /// Contracts all modes other than p_keep1 and p_keep2, which must differ.  Entry
+  /// (s1, s2) of the result is stored at p_result[s1 * GetRadix(p_keep2) + s2].
+  void Contract(const T *p_data, size_t p_keep1, size_t p_keep2, T *p_result) const;
+  /// Computes Contract(p_data, p_keep, j, p_results[j]) for every mode j other than
+  /// p_keep.  The contractions of the slowest-varying modes are shared among these, so
+  /// the cost is that of about two passes over the tensor, whatever the number of modes.
+  void ContractPairs(const T *p_data, size_t p_keep, const std::vector<T *> &p_results) const;
+
+private:
+  /// Contractions of modes whose blocks are shorter than this are done by inner products
+  static constexpr size_t MinimumBlockSize = 16;
+
+  std::vector<size_t> m_radices, m_strides;
+  std::vector<std::vector<T>> m_weights;
+  mutable std::vector<std::vector<T>> m_buffers, m_prefixes;
+  mutable std::vector<bool> m_prefixValid;
+
+  const T *ContractMode(const T *p_data, size_t p_mode) const;
+  const std::vector<T> &GetPrefix(size_t p_modes) const;
+  void Reduce(const T *p_data, size_t p_modes, const size_t *p_keep, size_t p_numKeep,
+              const size_t *p_resultStrides, T *p_result) const;
+  void ReduceSingles(const T *p_data, size_t p_modes, const std::vector<T *> &p_results,
+                     size_t p_row) const;
+};
+
+} // namespace Gambit
+
+#endif // GAMBIT_GAMES_TENSOR_H
@@ -34,3 +34,11 @@ class UndefinedOperationError(ValueError):
 class GameStructureChangedError(ValueError):
     """Raised when an object is no longer valid after a game structure change."""
     pass
+
+
+class ComputationCanceledError(RuntimeError):
+    """Raised when a computation is canceled through its `CancelToken`.
+
+    .. versionadded:: 17.0.0
+    """
+    pass
@@ -6,6 +6,7 @@ from libcpp.vector cimport vector as stdvector
 from libcpp.set cimport set as stdset
 from libcpp.map cimport map as stdmap
 from libcpp.optional cimport optional
+from libc.stdint cimport int64_t
 
 
 cdef extern from "games.h":
@@ -498,12 +499,20 @@ cdef extern from "util.h":
     c_Game ParseNfgGame(string) except +IOError
     c_Game ParseAggGame(string) except +IOError
     c_Game ParseBaggGame(string) except +IOError
+    c_Game ParseBinaryGame(string) except +IOError
     string WriteEfgFile(c_Game)
     string WriteNfgFile(c_Game)
+    string WriteBinaryFile(c_Game) except +IOError
     string WriteNfgFileSupport(c_StrategySupportProfile) except +IOError
     string WriteLaTeXFile(c_Game)
     string WriteHTMLFile(c_Game)
 
+    bool IsTableGame(c_Game) except +
+    void SetTablePayoffsDouble "SetTablePayoffs"(c_Game, int, const double *) except +ValueError
+    void SetTablePayoffsInt "SetTablePayoffs"(c_Game, int, const int64_t *) except +ValueError
+    void GetTablePayoffsDouble "GetTablePayoffs"(c_Game, int, double *) except +ValueError
+    void GetTablePayoffsInt "GetTablePayoffs"(c_Game, int, int64_t *) except +ValueError
+
     stdlist[shared_ptr[T]] make_list_of_pointer[T](stdlist[T]) except +
 
     void setitem_array_int "setitem"(Array[int] *, int, int) except +
@@ -545,61 +554,17 @@ cdef extern from "util.h":
     ) except +
 
 
-cdef extern from "solvers/enumpure/enumpure.h":
-    stdlist[c_MixedStrategyProfile[c_Rational]] EnumPureStrategySolve(c_Game) except +RuntimeError
-    stdlist[c_MixedBehaviorProfile[c_Rational]] EnumPureAgentSolve(c_Game) except +RuntimeError
-
-cdef extern from "solvers/enummixed/enummixed.h":
-    stdlist[c_MixedStrategyProfile[T]] EnumMixedStrategySolve[T](c_Game) except +RuntimeError
-
-cdef extern from "solvers/lcp/lcp.h":
-    stdlist[c_MixedStrategyProfile[T]] LcpStrategySolve[T](
-            c_Game, int p_stopAfter, int p_maxDepth
-    ) except +RuntimeError
-    stdlist[c_MixedBehaviorProfile[T]] LcpBehaviorSolve[T](c_Game) except +RuntimeError
-
-cdef extern from "solvers/lp/lp.h":
-    stdlist[c_MixedStrategyProfile[T]] LpStrategySolve[T](c_Game) except +RuntimeError
-    stdlist[c_MixedBehaviorProfile[T]] LpBehaviorSolve[T](c_Game) except +RuntimeError
-
-cdef extern from "solvers/liap/liap.h":
-    stdlist[c_MixedStrategyProfile[double]] LiapStrategySolve(
-            c_MixedStrategyProfile[double], double p_maxregret, int p_maxitsN
-    ) except +RuntimeError
-    stdlist[c_MixedBehaviorProfile[double]] LiapAgentSolve(
-            c_MixedBehaviorProfile[double], double p_maxregret, int p_maxitsN
-    ) except +RuntimeError
-
-cdef extern from "solvers/simpdiv/simpdiv.h":
-    stdlist[c_MixedStrategyProfile[c_Rational]] SimpdivStrategySolve(
-            c_MixedStrategyProfile[c_Rational] start, c_Rational p_maxregret, int p_gridResize,
-            int p_leashLength
-    ) except +RuntimeError
-
-cdef extern from "solvers/ipa/ipa.h":
-    stdlist[c_MixedStrategyProfile[double]] IPAStrategySolve(
-            c_MixedStrategyProfile[double]
-    ) except +RuntimeError
-
-cdef extern from "solvers/gnm/gnm.h":
-    stdlist[c_MixedStrategyProfile[double]] GNMStrategySolve(
-            c_MixedStrategyProfile[double], double p_endLambda, int p_steps,
-            int p_localNewtonInterval, int p_localNewtonMaxits
-    ) except +RuntimeError
+cdef extern from "core/cancel.h":
+    cdef cppclass c_CancelToken "CancelToken":
+        c_CancelToken() except +
+        void RequestCancel() nogil
+        bool IsCanceled() nogil
 
 cdef extern from "solvers/nashsupport/nashsupport.h":
     cdef cppclass c_PossibleNashStrategySupports "PossibleNashStrategySupports":
         c_PossibleNashStrategySupports(c_Game) except +
         optional[c_StrategySupportProfile] Next() except +RuntimeError
 
-cdef extern from "solvers/enumpoly/enumpoly.h":
-    stdlist[c_MixedStrategyProfile[double]] EnumPolyStrategySolve(
-            c_Game, int, float, size_t
-    ) except +RuntimeError
-    stdlist[c_MixedBehaviorProfile[double]] EnumPolyBehaviorSolve(
-            c_Game, int, float, size_t
-    ) except +RuntimeError
-
 cdef extern from "solvers/logit/logit.h":
     cdef cppclass c_LogitQREMixedBehaviorProfile "LogitQREMixedBehaviorProfile":
         c_LogitQREMixedBehaviorProfile(c_Game) except +
@@ -622,9 +587,51 @@ cdef extern from "solvers/logit/logit.h":
         double getitem "operator[]"(int) except +IndexError
 
 
-cdef extern from "nash.h":
+cdef extern from "nash.h" nogil:
+    stdlist[c_MixedStrategyProfile[c_Rational]] EnumPureStrategySolveWrapper(
+            c_Game, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedBehaviorProfile[c_Rational]] EnumPureAgentSolve(c_Game) except +RuntimeError
+    stdlist[c_MixedStrategyProfile[T]] EnumMixedStrategySolveWrapper[T](
+            c_Game, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedStrategyProfile[T]] LcpStrategySolveWrapper[T](
+            c_Game, int p_stopAfter, int p_maxDepth, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedBehaviorProfile[T]] LcpBehaviorSolveWrapper[T](
+            c_Game, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedStrategyProfile[T]] LpStrategySolveWrapper[T](
+            c_Game, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedBehaviorProfile[T]] LpBehaviorSolveWrapper[T](
+            c_Game, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedStrategyProfile[double]] LiapStrategySolveWrapper(
+            c_MixedStrategyProfile[double], double p_maxregret, int p_maxitsN, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedBehaviorProfile[double]] LiapAgentSolveWrapper(
+            c_MixedBehaviorProfile[double], double p_maxregret, int p_maxitsN, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedStrategyProfile[c_Rational]] SimpdivStrategySolveWrapper(
+            c_MixedStrategyProfile[c_Rational] start, c_Rational p_maxregret, int p_gridResize,
+            int p_leashLength, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedStrategyProfile[double]] IPAStrategySolveWrapper(
+            c_MixedStrategyProfile[double], c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedStrategyProfile[double]] GNMStrategySolveWrapper(
+            c_MixedStrategyProfile[double], double p_endLambda, int p_steps,
+            int p_localNewtonInterval, int p_localNewtonMaxits, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedStrategyProfile[double]] EnumPolyStrategySolveWrapper(
+            c_Game, int, double, size_t, c_CancelToken
+    ) except +RuntimeError
+    stdlist[c_MixedBehaviorProfile[double]] EnumPolyBehaviorSolveWrapper(
+            c_Game, int, double, size_t, c_CancelToken
+    ) except +RuntimeError
     stdlist[c_MixedBehaviorProfile[double]] LogitBehaviorSolveWrapper(
-            c_Game, double, double, double
+            c_Game, double, double, double, c_CancelToken
     ) except +
     stdlist[c_LogitQREMixedBehaviorProfile] LogitBehaviorPrincipalBranchWrapper(
             c_Game, double, double, double
@@ -636,7 +643,7 @@ cdef extern from "nash.h":
             shared_ptr[c_MixedBehaviorProfile[double]], bool, double, double
     ) except +
     stdlist[c_MixedStrategyProfile[double]] LogitStrategySolveWrapper(
-            c_Game, double, double, double
+            c_Game, double, double, double, c_CancelToken
     ) except +
     stdlist[c_LogitQREMixedStrategyProfile] LogitStrategyPrincipalBranchWrapper(
             c_Game, double, double, double
@@ -20,6 +20,7 @@
 # Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 #
 import collections.abc
+import contextlib
 import decimal
 import fractions
 import typing
@@ -161,6 +161,35 @@ def read_agg(filepath_or_buffer: str | pathlib.Path | io.IOBase) -> Game:
     return read_game(filepath_or_buffer, parser=ParseAggGame)
 
 
+def read_binary(filepath_or_buffer: str | pathlib.Path | io.IOBase) -> Game:
+    """Construct a game from its serialised representation in Gambit's binary format.
+
+    .. versionadded:: 17.0.0
+
+    Parameters
+    ----------
+    filepath_or_buffer : str, pathlib.Path or io.IOBase
+        The path to the file containing the game representation or binary file-like object
+
+    Returns
+    -------
+    Game
+        A game constructed from the representation in the file.
+
+    Raises
+    ------
+    IOError
+        If the file cannot be opened or read
+    ValueError
+        If the contents of the file are not a valid game representation.
+
+    See Also
+    --------
+    Game.to_binary, read_efg, read_nfg
+    """
+    return read_game(filepath_or_buffer, parser=ParseBinaryGame)
+
+
 def read_bagg(filepath_or_buffer: str | pathlib.Path | io.IOBase) -> Game:
     """Construct a game from its serialised representation in a BAGG file.
 
@@ -632,15 +661,17 @@ class Game:
             raise ValueError("All specified arrays must have the same shape")
         shape = arrays[0].shape
         g = Game.new_table(shape)
-        for profile in itertools.product(*(range(s) for s in shape)):
-            for array, player in zip(arrays, g.players, strict=True):
-                g[profile][player] = array[profile]
+        g._set_payoffs_from_arrays(arrays)
         g.title = title
         return g
 
     def to_arrays(self, dtype: typing.Type = Rational) -> list[np.array]:
         """Generate the payoff tables for players represented as numpy arrays.
 
+        .. versionchanged:: 17.0.0
+            For a game in table form, if `dtype` is ``float`` or ``int``, the
+            payoffs are copied in bulk into arrays of ``np.float64`` or ``np.int64``.
+
         Parameters
         ----------
         dtype : type
@@ -655,6 +686,16 @@ class Game:
         --------
         from_arrays : Create game from list-like of array-like
         """
+        bulk_dtypes = {
+            float: np.float64, np.float64: np.float64, int: np.int64, np.int64: np.int64
+        }
+        if dtype in bulk_dtypes and IsTableGame(self.game):
+            try:
+                return [self._get_table_payoffs(player, bulk_dtypes[dtype])
+                        for player in self.players]
+            except ValueError:
+                # Some payoff is not an integer; these are converted one by one
+                pass
         arrays = []
 
         shape = tuple(len(player.strategies) for player in self.players)
@@ -711,12 +752,65 @@ class Game:
         g.relabel_players(
             {player.label: label for player, label in zip(g.players, payoffs, strict=True)}
         )
-        for profile in itertools.product(*(range(s) for s in shape)):
-            for array, player in zip(arrays, g.players, strict=True):
-                g[profile][player] = array[profile]
+        g._set_payoffs_from_arrays(arrays)
         g.title = title
         return g
 
+    def _set_payoffs_from_arrays(self, arrays: list[np.ndarray]) -> None:
+        """Set the payoffs of a newly-created table game from the players' arrays.
+
+        Arrays of 64-bit floats or of integers are copied into the game in one pass
+        each; other arrays are converted entry by entry.
+        """
+        shape = arrays[0].shape
+        for array, player in zip(arrays, self.players, strict=True):
+            if not self._set_table_payoffs(player, array):
+                for profile in itertools.product(*(range(s) for s in shape)):
+                    self[profile][player] = array[profile]
+
+    @cython.cfunc
+    def _set_table_payoffs(self, player: Player, array: np.ndarray) -> bool:
+        """Set the payoffs to `player` from `array` through its buffer, if the game
+        is in table form and `array` holds 64-bit floats or integers which fit in
+        64 bits.  Returns whether the payoffs were set.
+
+        The table is laid out with the first player's strategy varying fastest,
+        which is the Fortran order of `array`.
+        """
+        if array.size == 0 or not IsTableGame(self.game):
+            return False
+        number: int = player.player.deref().GetNumber()
+        doubles: cython.double[::1]
+        integers: int64_t[::1]
+        if array.dtype == np.float64:
+            doubles = array.ravel(order="F")
+            SetTablePayoffsDouble(self.game, number, cython.address(doubles[0]))
+            return True
+        if array.dtype.kind in "iu" and np.can_cast(array.dtype, np.int64):
+            integers = array.astype(np.int64).ravel(order="F")
+            SetTablePayoffsInt(self.game, number, cython.address(integers[0]))
+            return True
+        return False
+
+    @cython.cfunc
+    def _get_table_payoffs(self, player: Player, dtype: typing.Type) -> np.ndarray:
+        """Return the payoffs to `player` as an array of `dtype`, which is
+        ``np.float64`` or ``np.int64``, copied through its buffer from the table."""
+        shape = tuple(len(p.strategies) for p in self.players)
+        array = np.zeros(shape=shape, dtype=dtype, order="F")
+        if array.size == 0:
+            return array
+        number: int = player.player.deref().GetNumber()
+        doubles: cython.double[::1]
+        integers: int64_t[::1]
+        if dtype == np.float64:
+            doubles = array.reshape(-1, order="F")
+            GetTablePayoffsDouble(self.game, number, cython.address(doubles[0]))
+        else:
+            integers = array.reshape(-1, order="F")
+            GetTablePayoffsInt(self.game, number, cython.address(integers[0]))
+        return array
+
     def __repr__(self) -> str:
         if self.title:
             return f"Game(title='{self.title}')"
@@ -1424,6 +1518,40 @@ class Game:
         """
         return self._to_format(WriteNfgFile, filepath_or_buffer)
 
+    def to_binary(
+        self,
+        filepath_or_buffer: str | pathlib.Path | io.IOBase | None = None
+    ) -> bytes | None:
+        """Save the game in Gambit's binary format or return its serialized representation
+
+        The binary format holds the same information as the .efg and .nfg formats,
+        but can be written and read much faster for large games.
+
+        .. versionadded:: 17.0.0
+
+        Parameters
+        ----------
+        filepath_or_buffer : str or Path or BufferedWriter or None, default None
+            String, path object, or binary file-like object implementing a write() function.
+            If None, the result is returned as bytes.
+
+        Return
+        ------
+        Binary representation of the game or None if the game is saved to a file
+
+        See Also
+        --------
+        read_binary, to_efg, to_nfg
+        """
+        serialized_game = WriteBinaryFile(self.game)
+        if filepath_or_buffer is None:
+            return serialized_game
+        if isinstance(filepath_or_buffer, io.IOBase):
+            filepath_or_buffer.write(serialized_game)
+        else:
+            with open(filepath_or_buffer, "wb") as f:
+                f.write(serialized_game)
+
     def to_html(
         self,
         filepath_or_buffer: str | pathlib.Path | io.IOBase | None = None
@@ -20,19 +20,139 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include "core/cancel.h"
+#include "solvers/enumpure/enumpure.h"
+#include "solvers/enummixed/enummixed.h"
+#include "solvers/lcp/lcp.h"
+#include "solvers/lp/lp.h"
+#include "solvers/liap/liap.h"
+#include "solvers/simpdiv/simpdiv.h"
+#include "solvers/ipa/ipa.h"
+#include "solvers/gnm/gnm.h"
+#include "solvers/enumpoly/enumpoly.h"
 #include "solvers/logit/logit.h"
 
 using namespace std;
 using namespace Gambit;
+using namespace Gambit::Nash;
 
-std::list<MixedBehaviorProfile<double>> LogitBehaviorSolveWrapper(const Game &p_game,
-                                                                  double p_regret,
-                                                                  double p_firstStep,
-                                                                  double p_maxAccel)
+//
+// The wrappers below are called by Cython without holding the GIL.  They pass
+// the default (null) callbacks, so no Python code is run during the computation,
+// and the computation can be canceled from another thread through p_cancel.
+//
+
+inline std::list<MixedStrategyProfile<Rational>>
+EnumPureStrategySolveWrapper(const Game &p_game, const CancelToken &p_cancel)
+{
+  return EnumPureStrategySolve(p_game, NullStrategyCallback<Rational>, p_cancel);
+}
+
+template <class T>
+std::list<MixedStrategyProfile<T>> EnumMixedStrategySolveWrapper(const Game &p_game,
+                                                                 const CancelToken &p_cancel)
+{
+  return EnumMixedStrategySolve<T>(p_game, NullStrategyCallback<T>, p_cancel);
+}
+
+template <class T>
+std::list<MixedStrategyProfile<T>> LcpStrategySolveWrapper(const Game &p_game, int p_stopAfter,
+                                                           int p_maxDepth,
+                                                           const CancelToken &p_cancel)
+{
+  return LcpStrategySolve<T>(p_game, p_stopAfter, p_maxDepth, NullStrategyCallback<T>,
+                             p_cancel);
+}
+
+template <class T>
+std::list<MixedBehaviorProfile<T>> LcpBehaviorSolveWrapper(const Game &p_game,
+                                                           const CancelToken &p_cancel)
+{
+  return LcpBehaviorSolve<T>(p_game, NullBehaviorCallback<T>, p_cancel);
+}
+
+template <class T>
+std::list<MixedStrategyProfile<T>> LpStrategySolveWrapper(const Game &p_game,
+                                                          const CancelToken &p_cancel)
+{
+  return LpStrategySolve<T>(p_game, NullStrategyCallback<T>, p_cancel);
+}
+
+template <class T>
+std::list<MixedBehaviorProfile<T>> LpBehaviorSolveWrapper(const Game &p_game,
+                                                          const CancelToken &p_cancel)
+{
+  return LpBehaviorSolve<T>(p_game, NullBehaviorCallback<T>, p_cancel);
+}
+
+inline std::list<MixedStrategyProfile<double>>
+LiapStrategySolveWrapper(const MixedStrategyProfile<double> &p_start, double p_maxregret,
+                         int p_maxits, const CancelToken &p_cancel)
+{
+  return LiapStrategySolve(p_start, p_maxregret, p_maxits, NullStrategyCallback<double>,
+                           NullLiapEventCallback<MixedStrategyProfile<double>>, p_cancel);
+}
+
+inline std::list<MixedBehaviorProfile<double>>
+LiapAgentSolveWrapper(const MixedBehaviorProfile<double> &p_start, double p_maxregret,
+                      int p_maxits, const CancelToken &p_cancel)
+{
+  return LiapAgentSolve(p_start, p_maxregret, p_maxits, NullBehaviorCallback<double>,
+                        NullLiapEventCallback<MixedBehaviorProfile<double>>, p_cancel);
+}
+
+inline std::list<MixedStrategyProfile<Rational>>
+SimpdivStrategySolveWrapper(const MixedStrategyProfile<Rational> &p_start,
+                            const Rational &p_maxregret, int p_gridResize, int p_leashLength,
+                            const CancelToken &p_cancel)
+{
+  return SimpdivStrategySolve(p_start, p_maxregret, p_gridResize, p_leashLength,
+                              NullStrategyCallback<Rational>, NullSimpdivEventCallback,
+                              p_cancel);
+}
+
+inline std::list<MixedStrategyProfile<double>>
+IPAStrategySolveWrapper(const MixedStrategyProfile<double> &p_pert, const CancelToken &p_cancel)
+{
+  return IPAStrategySolve(p_pert, NullStrategyCallback<double>, NullIPAEventCallback, p_cancel);
+}
+
+inline std::list<MixedStrategyProfile<double>>
+GNMStrategySolveWrapper(const MixedStrategyProfile<double> &p_pert, double p_endLambda,
+                        int p_steps, int p_localNewtonInterval, int p_localNewtonMaxits,
+                        const CancelToken &p_cancel)
+{
+  return GNMStrategySolve(p_pert, p_endLambda, p_steps, p_localNewtonInterval,
+                          p_localNewtonMaxits, NullStrategyCallback<double>,
+                          NullGNMEventCallback, p_cancel);
+}
+
+inline std::list<MixedStrategyProfile<double>>
+EnumPolyStrategySolveWrapper(const Game &p_game, int p_stopAfter, double p_maxregret,
+                             size_t p_maxRectangles, const CancelToken &p_cancel)
+{
+  return EnumPolyStrategySolve(p_game, p_stopAfter, p_maxregret, p_maxRectangles,
+                               NullStrategyCallback<double>,
+                               NullEnumPolyEventCallback<StrategySupportProfile>, p_cancel);
+}
+
+inline std::list<MixedBehaviorProfile<double>>
+EnumPolyBehaviorSolveWrapper(const Game &p_game, int p_stopAfter, double p_maxregret,
+                             size_t p_maxRectangles, const CancelToken &p_cancel)
+{
+  return EnumPolyBehaviorSolve(p_game, p_stopAfter, p_maxregret, p_maxRectangles,
+                               NullBehaviorCallback<double>,
+                               NullEnumPolyEventCallback<BehaviorSupportProfile>, p_cancel);
+}
+
+std::list<MixedBehaviorProfile<double>>
+LogitBehaviorSolveWrapper(const Game &p_game, double p_regret, double p_firstStep, double p_maxAccel,
+                          const CancelToken &p_cancel)
 {
   std::list<MixedBehaviorProfile<double>> ret;
   ret.push_back(LogitBehaviorSolve(LogitQREMixedBehaviorProfile(p_game), p_regret, 1.0,
-                                   p_firstStep, p_maxAccel)
+                                   p_firstStep, p_maxAccel, NullBehaviorCallback<double>,
+                                   NullLogitEventCallback<LogitQREMixedBehaviorProfile>, p_cancel)
                     .back()
                     .GetProfile());
   return ret;
@@ -66,14 +186,14 @@ LogitBehaviorAtLambdaWrapper(const Game &p_game, const std::list<double> &p_targ
   return ret;
 }
 
-std::list<MixedStrategyProfile<double>> LogitStrategySolveWrapper(const Game &p_game,
-                                                                  double p_regret,
-                                                                  double p_firstStep,
-                                                                  double p_maxAccel)
+std::list<MixedStrategyProfile<double>>
+LogitStrategySolveWrapper(const Game &p_game, double p_regret, double p_firstStep, double p_maxAccel,
+                          const CancelToken &p_cancel)
 {
   std::list<MixedStrategyProfile<double>> ret;
   ret.push_back(LogitStrategySolve(LogitQREMixedStrategyProfile(p_game), p_regret, 1.0,
-                                   p_firstStep, p_maxAccel)
+                                   p_firstStep, p_maxAccel, NullStrategyCallback<double>,
+                                   NullLogitEventCallback<LogitQREMixedStrategyProfile>, p_cancel)
                     .back()
                     .GetProfile());
   return ret;
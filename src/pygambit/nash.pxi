@@ -57,91 +57,245 @@ def _convert_mbpr(
             for profile in make_list_of_pointer(inlist)]
 
 
-def _enumpure_strategy_solve(game: Game) -> list[MixedStrategyProfile[c_Rational]]:
-    return _convert_mspr(EnumPureStrategySolve(game.game))
+@cython.cclass
+class CancelToken:
+    """A handle by which an equilibrium computation may be canceled from another thread.
 
+    Pass the token as the `cancel` argument of a solver.  The computation is run without
+    holding the global interpreter lock, so other threads may run meanwhile; calling
+    `cancel` from any of them causes the computation to stop at its next opportunity,
+    raising `ComputationCanceledError`.  A token remains canceled once `cancel` has been
+    called, so a new token is needed for each computation to be run.
 
-def _enumpure_agent_solve(game: Game) -> list[MixedBehaviorProfileRational]:
-    return _convert_mbpr(EnumPureAgentSolve(game.game))
+    .. versionadded:: 17.0.0
+    """
+    token = cython.declare(c_CancelToken)
 
+    def __repr__(self) -> str:
+        return f"CancelToken(canceled={self.canceled})"
 
-def _enummixed_strategy_solve_double(game: Game) -> list[MixedStrategyProfileDouble]:
-    return _convert_mspd(EnumMixedStrategySolve[double](game.game))
+    def cancel(self) -> None:
+        """Request cancellation of the computations using this token."""
+        self.token.RequestCancel()
 
+    @property
+    def canceled(self) -> bool:
+        """Whether cancellation has been requested."""
+        return self.token.IsCanceled()
 
-def _enummixed_strategy_solve_rational(game: Game) -> list[MixedStrategyProfileRational]:
-    return _convert_mspr(EnumMixedStrategySolve[c_Rational](game.game))
+
+@cython.cfunc
+def _cancel_token(cancel) -> c_CancelToken:
+    if cancel is None:
+        return c_CancelToken()
+    return cython.cast(CancelToken, cancel).token
+
+
+@contextlib.contextmanager
+def _translate_cancellation(cancel):
+    try:
+        yield
+    except RuntimeError:
+        if cancel is not None and cancel.canceled:
+            raise ComputationCanceledError("Computation canceled") from None
+        raise
+
+
+def _enumpure_strategy_solve(game: Game, cancel=None) -> list[MixedStrategyProfile[c_Rational]]:
+    c_game: c_Game = game.game
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[c_Rational]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = EnumPureStrategySolveWrapper(c_game, token)
+    return _convert_mspr(result)
+
+
+def _enumpure_agent_solve(game: Game) -> list[MixedBehaviorProfileRational]:
+    c_game: c_Game = game.game
+    result: stdlist[c_MixedBehaviorProfile[c_Rational]]
+    with cython.nogil:
+        result = EnumPureAgentSolve(c_game)
+    return _convert_mbpr(result)
+
+
+def _enummixed_strategy_solve_double(game: Game,
+                                     cancel=None) -> list[MixedStrategyProfileDouble]:
+    c_game: c_Game = game.game
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = EnumMixedStrategySolveWrapper[double](c_game, token)
+    return _convert_mspd(result)
+
+
+def _enummixed_strategy_solve_rational(game: Game,
+                                       cancel=None) -> list[MixedStrategyProfileRational]:
+    c_game: c_Game = game.game
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[c_Rational]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = EnumMixedStrategySolveWrapper[c_Rational](c_game, token)
+    return _convert_mspr(result)
 
 
 def _lcp_behavior_solve_double(
-        game: Game
+        game: Game, cancel=None
 ) -> list[MixedBehaviorProfileDouble]:
-    return _convert_mbpd(LcpBehaviorSolve[double](game.game))
+    c_game: c_Game = game.game
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedBehaviorProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LcpBehaviorSolveWrapper[double](c_game, token)
+    return _convert_mbpd(result)
 
 
 def _lcp_behavior_solve_rational(
-        game: Game
+        game: Game, cancel=None
 ) -> list[MixedBehaviorProfileRational]:
-    return _convert_mbpr(LcpBehaviorSolve[c_Rational](game.game))
+    c_game: c_Game = game.game
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedBehaviorProfile[c_Rational]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LcpBehaviorSolveWrapper[c_Rational](c_game, token)
+    return _convert_mbpr(result)
 
 
 def _lcp_strategy_solve_double(
-        game: Game, stop_after: int, max_depth: int
+        game: Game, stop_after: int, max_depth: int, cancel=None
 ) -> list[MixedStrategyProfileDouble]:
-    return _convert_mspd(LcpStrategySolve[double](game.game, stop_after, max_depth))
+    c_game: c_Game = game.game
+    c_stop_after: cython.int = stop_after
+    c_max_depth: cython.int = max_depth
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LcpStrategySolveWrapper[double](c_game, c_stop_after, c_max_depth, token)
+    return _convert_mspd(result)
 
 
 def _lcp_strategy_solve_rational(
-        game: Game, stop_after: int, max_depth: int
+        game: Game, stop_after: int, max_depth: int, cancel=None
 ) -> list[MixedStrategyProfileRational]:
-    return _convert_mspr(LcpStrategySolve[c_Rational](game.game, stop_after, max_depth))
-
-
-def _lp_behavior_solve_double(game: Game) -> list[MixedBehaviorProfileDouble]:
-    return _convert_mbpd(LpBehaviorSolve[double](game.game))
-
-
-def _lp_behavior_solve_rational(game: Game) -> list[MixedBehaviorProfileRational]:
-    return _convert_mbpr(LpBehaviorSolve[c_Rational](game.game))
-
-
-def _lp_strategy_solve_double(game: Game) -> list[MixedStrategyProfileDouble]:
-    return _convert_mspd(LpStrategySolve[double](game.game))
-
-
-def _lp_strategy_solve_rational(game: Game) -> list[MixedStrategyProfileRational]:
-    return _convert_mspr(LpStrategySolve[c_Rational](game.game))
+    c_game: c_Game = game.game
+    c_stop_after: cython.int = stop_after
+    c_max_depth: cython.int = max_depth
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[c_Rational]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LcpStrategySolveWrapper[c_Rational](c_game, c_stop_after, c_max_depth,
+                                                         token)
+    return _convert_mspr(result)
+
+
+def _lp_behavior_solve_double(game: Game, cancel=None) -> list[MixedBehaviorProfileDouble]:
+    c_game: c_Game = game.game
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedBehaviorProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LpBehaviorSolveWrapper[double](c_game, token)
+    return _convert_mbpd(result)
+
+
+def _lp_behavior_solve_rational(game: Game, cancel=None) -> list[MixedBehaviorProfileRational]:
+    c_game: c_Game = game.game
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedBehaviorProfile[c_Rational]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LpBehaviorSolveWrapper[c_Rational](c_game, token)
+    return _convert_mbpr(result)
+
+
+def _lp_strategy_solve_double(game: Game, cancel=None) -> list[MixedStrategyProfileDouble]:
+    c_game: c_Game = game.game
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LpStrategySolveWrapper[double](c_game, token)
+    return _convert_mspd(result)
+
+
+def _lp_strategy_solve_rational(game: Game, cancel=None) -> list[MixedStrategyProfileRational]:
+    c_game: c_Game = game.game
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[c_Rational]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LpStrategySolveWrapper[c_Rational](c_game, token)
+    return _convert_mspr(result)
 
 
 def _liap_strategy_solve(start: MixedStrategyProfileDouble,
                          maxregret: float,
-                         maxiter: int) -> list[MixedStrategyProfileDouble]:
-    return _convert_mspd(LiapStrategySolve(deref(start.profile), maxregret, maxiter))
+                         maxiter: int,
+                         cancel=None) -> list[MixedStrategyProfileDouble]:
+    profile: shared_ptr[c_MixedStrategyProfile[double]] = start.profile
+    c_maxregret: cython.double = maxregret
+    c_maxiter: cython.int = maxiter
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LiapStrategySolveWrapper(deref(profile), c_maxregret, c_maxiter, token)
+    return _convert_mspd(result)
 
 
 def _liap_behavior_solve(start: MixedBehaviorProfileDouble,
                          maxregret: float,
-                         maxiter: int) -> list[MixedBehaviorProfileDouble]:
-    return _convert_mbpd(LiapAgentSolve(deref(start.profile), maxregret, maxiter))
+                         maxiter: int,
+                         cancel=None) -> list[MixedBehaviorProfileDouble]:
+    profile: shared_ptr[c_MixedBehaviorProfile[double]] = start.profile
+    c_maxregret: cython.double = maxregret
+    c_maxiter: cython.int = maxiter
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedBehaviorProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LiapAgentSolveWrapper(deref(profile), c_maxregret, c_maxiter, token)
+    return _convert_mbpd(result)
 
 
 def _simpdiv_strategy_solve(
-        start: MixedStrategyProfileRational, maxregret: Rational, gridstep: int, leash: int
+        start: MixedStrategyProfileRational, maxregret: Rational, gridstep: int, leash: int,
+        cancel=None
 ) -> list[MixedStrategyProfileRational]:
-    return _convert_mspr(SimpdivStrategySolve(deref(start.profile),
-                                              to_rational(str(maxregret).encode("ascii")),
-                                              gridstep, leash))
+    profile: shared_ptr[c_MixedStrategyProfile[c_Rational]] = start.profile
+    c_maxregret: c_Rational = to_rational(str(maxregret).encode("ascii"))
+    c_gridstep: cython.int = gridstep
+    c_leash: cython.int = leash
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[c_Rational]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = SimpdivStrategySolveWrapper(deref(profile), c_maxregret, c_gridstep,
+                                                 c_leash, token)
+    return _convert_mspr(result)
 
 
 def _ipa_strategy_solve(
-        pert: MixedStrategyProfileDouble
+        pert: MixedStrategyProfileDouble, cancel=None
 ) -> list[MixedStrategyProfileDouble]:
+    profile: shared_ptr[c_MixedStrategyProfile[double]] = pert.profile
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[double]]
     try:
-        return _convert_mspd(IPAStrategySolve(deref(pert.profile)))
+        with _translate_cancellation(cancel):
+            with cython.nogil:
+                result = IPAStrategySolveWrapper(deref(profile), token)
     except RuntimeError as e:
         if "does not have unique maximizer" in str(e):
             raise ValueError(str(e)) from None
         raise
+    return _convert_mspd(result)
 
 
 def _gnm_strategy_solve(
@@ -150,14 +304,25 @@ def _gnm_strategy_solve(
         steps: int,
         local_newton_interval: int,
         local_newton_maxits: int,
+        cancel=None
 ) -> list[MixedStrategyProfileDouble]:
+    profile: shared_ptr[c_MixedStrategyProfile[double]] = pert.profile
+    c_end_lambda: cython.double = end_lambda
+    c_steps: cython.int = steps
+    c_interval: cython.int = local_newton_interval
+    c_maxits: cython.int = local_newton_maxits
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[double]]
     try:
-        return _convert_mspd(GNMStrategySolve(deref(pert.profile), end_lambda,
-                                              steps, local_newton_interval, local_newton_maxits))
+        with _translate_cancellation(cancel):
+            with cython.nogil:
+                result = GNMStrategySolveWrapper(deref(profile), c_end_lambda, c_steps,
+                                                 c_interval, c_maxits, token)
     except RuntimeError as e:
         if "does not have unique maximizer" in str(e):
             raise ValueError(str(e)) from None
         raise
+    return _convert_mspd(result)
 
 
 def _nashsupport_strategy_solve(
@@ -181,8 +346,19 @@ def _enumpoly_strategy_solve(
         stop_after: int,
         maxregret: float,
         max_rectangles: int,
+        cancel=None
 ) -> list[MixedStrategyProfileDouble]:
-    return _convert_mspd(EnumPolyStrategySolve(game.game, stop_after, maxregret, max_rectangles))
+    c_game: c_Game = game.game
+    c_stop_after: cython.int = stop_after
+    c_maxregret: cython.double = maxregret
+    c_max_rectangles: cython.size_t = max_rectangles
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = EnumPolyStrategySolveWrapper(c_game, c_stop_after, c_maxregret,
+                                                  c_max_rectangles, token)
+    return _convert_mspd(result)
 
 
 def _enumpoly_behavior_solve(
@@ -190,20 +366,51 @@ def _enumpoly_behavior_solve(
         stop_after: int,
         maxregret: float,
         max_rectangles: int,
+        cancel=None
 ) -> list[MixedBehaviorProfileDouble]:
-    return _convert_mbpd(EnumPolyBehaviorSolve(game.game, stop_after, maxregret, max_rectangles))
+    c_game: c_Game = game.game
+    c_stop_after: cython.int = stop_after
+    c_maxregret: cython.double = maxregret
+    c_max_rectangles: cython.size_t = max_rectangles
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedBehaviorProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = EnumPolyBehaviorSolveWrapper(c_game, c_stop_after, c_maxregret,
+                                                  c_max_rectangles, token)
+    return _convert_mbpd(result)
 
 
 def _logit_strategy_solve(
-        game: Game, maxregret: float, first_step: float, max_accel: float,
+        game: Game, maxregret: float, first_step: float, max_accel: float, cancel=None
 ) -> list[MixedStrategyProfileDouble]:
-    return _convert_mspd(LogitStrategySolveWrapper(game.game, maxregret, first_step, max_accel))
+    c_game: c_Game = game.game
+    c_maxregret: cython.double = maxregret
+    c_first_step: cython.double = first_step
+    c_max_accel: cython.double = max_accel
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedStrategyProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LogitStrategySolveWrapper(c_game, c_maxregret, c_first_step, c_max_accel,
+                                               token)
+    return _convert_mspd(result)
 
 
 def _logit_behavior_solve(
-        game: Game, maxregret: float, first_step: float, max_accel: float,
+        game: Game, maxregret: float, first_step: float, max_accel: float, cancel=None
 ) -> list[MixedBehaviorProfileDouble]:
-    return _convert_mbpd(LogitBehaviorSolveWrapper(game.game, maxregret, first_step, max_accel))
+    c_game: c_Game = game.game
+    c_maxregret: cython.double = maxregret
+    c_first_step: cython.double = first_step
+    c_max_accel: cython.double = max_accel
+    token: c_CancelToken = _cancel_token(cancel)
+    result: stdlist[c_MixedBehaviorProfile[double]]
+    with _translate_cancellation(cancel):
+        with cython.nogil:
+            result = LogitBehaviorSolveWrapper(c_game, c_maxregret, c_first_step, c_max_accel,
+                                               token)
+    return _convert_mbpd(result)
 
 
 @cython.cclass
@@ -67,7 +67,10 @@ class NashComputationResult:
     parameters: dict = dataclasses.field(default_factory=dict)
 
 
-def enumpure_solve(game: libgbt.Game) -> NashComputationResult:
+def enumpure_solve(
+        game: libgbt.Game,
+        cancel: libgbt.CancelToken | None = None
+) -> NashComputationResult:
     """Compute all :ref:`pure-strategy Nash equilibria <enumpure>` of game.
 
     .. versionchanged:: 16.5.0
@@ -80,6 +83,12 @@ def enumpure_solve(game: libgbt.Game) -> NashComputationResult:
     game : Game
         The game to compute equilibria in.
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -94,7 +103,7 @@ def enumpure_solve(game: libgbt.Game) -> NashComputationResult:
         method="enumpure",
         rational=True,
         use_strategic=True,
-        equilibria=libgbt._enumpure_strategy_solve(game)
+        equilibria=libgbt._enumpure_strategy_solve(game, cancel)
     )
 
 
@@ -132,6 +141,7 @@ def enummixed_solve(
         game: libgbt.Game,
         rational: bool = True,
         lrsnash_path: pathlib.Path | str | None = None,
+        cancel: libgbt.CancelToken | None = None,
 ) -> NashComputationResult:
     """Compute all :ref:`mixed-strategy Nash equilibria <enummixed>`
     of a two-player game using the strategic representation.
@@ -151,6 +161,12 @@ def enummixed_solve(
 
         .. versionadded:: 16.3.0
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -176,9 +192,9 @@ def enummixed_solve(
             equilibria=equilibria,
         )
     if rational:
-        equilibria = libgbt._enummixed_strategy_solve_rational(game)
+        equilibria = libgbt._enummixed_strategy_solve_rational(game, cancel)
     else:
-        equilibria = libgbt._enummixed_strategy_solve_double(game)
+        equilibria = libgbt._enummixed_strategy_solve_double(game, cancel)
     return NashComputationResult(
         game=game,
         method="enummixed",
@@ -193,7 +209,8 @@ def lcp_solve(
         rational: bool = True,
         use_strategic: bool = False,
         stop_after: int | None = None,
-        max_depth: int | None = None
+        max_depth: int | None = None,
+        cancel: libgbt.CancelToken | None = None
 ) -> NashComputationResult:
     """Compute Nash equilibria of a two-player game using :ref:`linear
     complementarity programming <lcp>`.
@@ -220,6 +237,12 @@ def lcp_solve(
         If specified, will limit the recursive search, but may result in some accessible
         equilibria not being found.
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -248,13 +271,17 @@ def lcp_solve(
         )
     if not game.is_tree or use_strategic:
         if rational:
-            equilibria = libgbt._lcp_strategy_solve_rational(game, stop_after or 0, max_depth or 0)
+            equilibria = libgbt._lcp_strategy_solve_rational(
+                game, stop_after or 0, max_depth or 0, cancel
+            )
         else:
-            equilibria = libgbt._lcp_strategy_solve_double(game, stop_after or 0, max_depth or 0)
+            equilibria = libgbt._lcp_strategy_solve_double(
+                game, stop_after or 0, max_depth or 0, cancel
+            )
     elif rational:
-        equilibria = libgbt._lcp_behavior_solve_rational(game)
+        equilibria = libgbt._lcp_behavior_solve_rational(game, cancel)
     else:
-        equilibria = libgbt._lcp_behavior_solve_double(game)
+        equilibria = libgbt._lcp_behavior_solve_double(game, cancel)
     return NashComputationResult(
         game=game,
         method="lcp",
@@ -268,7 +295,8 @@ def lcp_solve(
 def lp_solve(
         game: libgbt.Game,
         rational: bool = True,
-        use_strategic: bool = False
+        use_strategic: bool = False,
+        cancel: libgbt.CancelToken | None = None
 ) -> NashComputationResult:
     """Compute Nash equilibria of a two-player constant-sum game using :ref:`linear
     programming <lp>`.
@@ -286,6 +314,12 @@ def lp_solve(
         Whether to use the strategic form.  If `True`, always uses the strategic
         representation even if the game's native representation is extensive.
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -298,13 +332,13 @@ def lp_solve(
     """
     if not game.is_tree or use_strategic:
         if rational:
-            equilibria = libgbt._lp_strategy_solve_rational(game)
+            equilibria = libgbt._lp_strategy_solve_rational(game, cancel)
         else:
-            equilibria = libgbt._lp_strategy_solve_double(game)
+            equilibria = libgbt._lp_strategy_solve_double(game, cancel)
     elif rational:
-        equilibria = libgbt._lp_behavior_solve_rational(game)
+        equilibria = libgbt._lp_behavior_solve_rational(game, cancel)
     else:
-        equilibria = libgbt._lp_behavior_solve_double(game)
+        equilibria = libgbt._lp_behavior_solve_double(game, cancel)
     return NashComputationResult(
         game=game,
         method="lp",
@@ -317,7 +351,8 @@ def lp_solve(
 def liap_solve(
         start: libgbt.MixedStrategyProfileDouble,
         maxregret: float = 1.0e-4,
-        maxiter: int = 1000
+        maxiter: int = 1000,
+        cancel: libgbt.CancelToken | None = None
 ) -> NashComputationResult:
     """Compute approximate Nash equilibria of a game using
     :ref:`Lyapunov function minimization <liap>`.
@@ -352,6 +387,12 @@ def liap_solve(
 
         .. versionadded: 16.2.0
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -360,7 +401,8 @@ def liap_solve(
     if maxregret <= 0.0:
         raise ValueError("liap_solve(): maxregret argument must be positive")
     equilibria = libgbt._liap_strategy_solve(start,
-                                             maxregret=maxregret, maxiter=maxiter)
+                                             maxregret=maxregret, maxiter=maxiter,
+                                             cancel=cancel)
     return NashComputationResult(
         game=start.game,
         method="liap",
@@ -374,7 +416,8 @@ def liap_solve(
 def liap_agent_solve(
         start: libgbt.MixedBehaviorProfileDouble,
         maxregret: float = 1.0e-4,
-        maxiter: int = 1000
+        maxiter: int = 1000,
+        cancel: libgbt.CancelToken | None = None
 ) -> NashComputationResult:
     """Compute approximate agent Nash equilibria of a game using
     :ref:`Lyapunov function minimization <gambit-liap>`.
@@ -399,6 +442,12 @@ def liap_agent_solve(
     maxiter : int, default 1000
         Maximum number of iterations in function minimization.
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -407,7 +456,8 @@ def liap_agent_solve(
     if maxregret <= 0.0:
         raise ValueError("liap_solve(): maxregret argument must be positive")
     equilibria = libgbt._liap_behavior_solve(start,
-                                             maxregret=maxregret, maxiter=maxiter)
+                                             maxregret=maxregret, maxiter=maxiter,
+                                             cancel=cancel)
     return NashComputationResult(
         game=start.game,
         method="liap-agent",
@@ -422,7 +472,8 @@ def simpdiv_solve(
         start: libgbt.MixedStrategyProfileRational,
         maxregret: libgbt.Rational | None = None,
         refine: int = 2,
-        leash: int | None = None
+        leash: int | None = None,
+        cancel: libgbt.CancelToken | None = None
 ) -> NashComputationResult:
     """Compute Nash equilibria of a game using :ref:`simplicial
     subdivision <simpdiv>`.
@@ -456,6 +507,12 @@ def simpdiv_solve(
         may explore.  This trades off the possibility of finding an equilibrium more
         quickly by giving up the guarantee than an equilibrium will necessarily be found.
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -469,7 +526,8 @@ def simpdiv_solve(
         maxregret = libgbt.Rational(1, 10000000)
     elif maxregret < libgbt.Rational(0):
         raise ValueError("simpdiv_solve(): maxregret must be positive")
-    equilibria = libgbt._simpdiv_strategy_solve(start, maxregret, refine, leash or 0)
+    equilibria = libgbt._simpdiv_strategy_solve(start, maxregret, refine, leash or 0,
+                                                cancel)
     return NashComputationResult(
         game=start.game,
         method="simpdiv",
@@ -482,6 +540,7 @@ def simpdiv_solve(
 
 def ipa_solve(
         perturbation: libgbt.Game | libgbt.MixedStrategyProfileDouble,
+        cancel: libgbt.CancelToken | None = None,
 ) -> NashComputationResult:
     """Compute Nash equilibria of a game using :ref:`iterated polymatrix
     approximation <ipa>`.
@@ -503,6 +562,12 @@ def ipa_solve(
         If the perturbation vector does not have a unique maximizer for
         each player
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -529,7 +594,7 @@ def ipa_solve(
         rational=False,
         use_strategic=True,
         parameters={"perturbation": perturbation},
-        equilibria=libgbt._ipa_strategy_solve(perturbation),
+        equilibria=libgbt._ipa_strategy_solve(perturbation, cancel),
     )
 
 
@@ -539,6 +604,7 @@ def gnm_solve(
         steps: int = 100,
         local_newton_interval: int = 3,
         local_newton_maxits: int = 10,
+        cancel: libgbt.CancelToken | None = None,
 ) -> NashComputationResult:
     """Compute Nash equilibria of a game using :ref:`a global Newton
     method <gnm>`.
@@ -586,6 +652,12 @@ def gnm_solve(
         each player, or arguments controlling the behavior of the numerical
         tracing are not valid.
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -631,7 +703,8 @@ def gnm_solve(
                         "local_newton_maxits": local_newton_maxits},
             equilibria=libgbt._gnm_strategy_solve(perturbation, end_lambda,
                                                   steps,
-                                                  local_newton_interval, local_newton_maxits)
+                                                  local_newton_interval, local_newton_maxits,
+                                                  cancel)
         )
     except RuntimeError as e:
         if "at least one nonzero" in str(e):
@@ -666,7 +739,8 @@ def enumpoly_solve(
         stop_after: int | None = None,
         maxregret: float = 1.0e-8,
         max_rectangles: int = 20_000,
-        phcpack_path: pathlib.Path | str | None = None
+        phcpack_path: pathlib.Path | str | None = None,
+        cancel: libgbt.CancelToken | None = None
 ) -> NashComputationResult:
     """:ref:`Compute Nash equilibria by enumerating all support profiles
     of strategies or actions, and for each support finding all totally-mixed equilibria of
@@ -702,6 +776,12 @@ def enumpoly_solve(
         This argument specifies the path to the PHCpack executable.
         With this method, only enumeration on the strategic game is supported.
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -745,9 +825,13 @@ def enumpoly_solve(
         )
 
     if not game.is_tree or use_strategic:
-        equilibria = libgbt._enumpoly_strategy_solve(game, stop_after, maxregret, max_rectangles)
+        equilibria = libgbt._enumpoly_strategy_solve(
+            game, stop_after, maxregret, max_rectangles, cancel
+        )
     else:
-        equilibria = libgbt._enumpoly_behavior_solve(game, stop_after, maxregret, max_rectangles)
+        equilibria = libgbt._enumpoly_behavior_solve(
+            game, stop_after, maxregret, max_rectangles, cancel
+        )
     return NashComputationResult(
         game=game,
         method="enumpoly",
@@ -765,6 +849,7 @@ def logit_solve(
         maxregret: float = 1.0e-8,
         first_step: float = .03,
         max_accel: float = 1.1,
+        cancel: libgbt.CancelToken | None = None,
 ) -> NashComputationResult:
     """Compute Nash equilibria of a game using :ref:`the logit quantal response
     equilibrium correspondence <logit>`.
@@ -798,6 +883,12 @@ def logit_solve(
 
         .. versionadded:: 16.2.0
 
+    cancel : CancelToken, optional
+        A token through which the computation may be canceled from another thread,
+        in which case ``ComputationCanceledError`` is raised.
+
+        .. versionadded:: 17.0.0
+
     Returns
     -------
     res : NashComputationResult
@@ -810,9 +901,13 @@ def logit_solve(
     if max_accel < 1.0:
         raise ValueError("logit_solve(): max_accel argument must be at least 1.0")
     if not game.is_tree or use_strategic:
-        equilibria = libgbt._logit_strategy_solve(game, maxregret, first_step, max_accel)
+        equilibria = libgbt._logit_strategy_solve(
+            game, maxregret, first_step, max_accel, cancel
+        )
     else:
-        equilibria = libgbt._logit_behavior_solve(game, maxregret, first_step, max_accel)
+        equilibria = libgbt._logit_behavior_solve(
+            game, maxregret, first_step, max_accel, cancel
+        )
     return NashComputationResult(
         game=game,
         method="logit",
@@ -30,6 +30,7 @@
 #include <fstream>
 #include <sstream>
 #include "games/game.h"
+#include "games/gametable.h"
 #include "games/writer.h"
 #include "games/stratspt.h"
 #include "games/gameagg.h"
@@ -66,6 +67,12 @@ Game ParseBaggGame(std::string const &s)
   return ReadBaggFile(f);
 }
 
+Game ParseBinaryGame(std::string const &s)
+{
+  std::istringstream f(s);
+  return ReadBinaryFile(f);
+}
+
 std::string WriteEfgFile(const Game &p_game)
 {
   std::ostringstream f;
@@ -80,6 +87,13 @@ std::string WriteNfgFile(const Game &p_game)
   return f.str();
 }
 
+std::string WriteBinaryFile(const Game &p_game)
+{
+  std::ostringstream f;
+  WriteBinaryFile(p_game, f);
+  return f.str();
+}
+
 std::string WriteHTMLFile(const Game &p_game)
 {
   return WriteHTMLFile(p_game, p_game->GetPlayer(1), p_game->GetPlayer(2));
@@ -97,6 +111,30 @@ std::string WriteNfgFileSupport(const StrategySupportProfile &p_support)
   return f.str();
 }
 
+// Bulk access to the payoffs of a game in table form, laid out as in GameTableRep
+bool IsTableGame(const Game &p_game)
+{
+  return dynamic_cast<const GameTableRep *>(p_game.get()) != nullptr;
+}
+
+GameTableRep &AsTableGame(const Game &p_game)
+{
+  if (auto *table = dynamic_cast<GameTableRep *>(p_game.get())) {
+    return *table;
+  }
+  throw UndefinedException("Game is not in table form");
+}
+
+template <class T> void SetTablePayoffs(const Game &p_game, int p_player, const T *p_payoffs)
+{
+  AsTableGame(p_game).SetPayoffs(p_player, p_payoffs);
+}
+
+template <class T> void GetTablePayoffs(const Game &p_game, int p_player, T *p_payoffs)
+{
+  AsTableGame(p_game).GetPayoffs(p_player, p_payoffs);
+}
+
 template <template <class> class C, class T, class X>
 std::shared_ptr<T> sharedcopyitem(const C<T> &p_container, const X &p_index)
 {
@@ -20,7 +20,11 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include <bit>
+#include <cstdint>
+
 #include "games.h"
+#include "core/parallel.h"
 #include "solvers/linalg/vertenum.h"
 #include "solvers/enummixed/enummixed.h"
 #include "clique.h"
@@ -37,6 +41,62 @@ bool EqZero(const double &x)
 
 bool EqZero(const Rational &x) { return x == Rational(0); }
 
+namespace {
+
+/// The labels of a vertex at which it may fail to be complementary to a vertex of
+/// the other polytope, as bitsets.  A structural variable or slack is marked if it
+/// is basic with a nonzero value.  A pair of vertices can only fail to be complementary
+/// at labels where the structural variables marked for one meet the slacks marked for
+/// the other, so most pairs are settled by a few word-wide intersections.
+class VertexLabels {
+public:
+  using Bitset = std::vector<std::uint64_t>;
+
+  template <class T>
+  VertexLabels(const BFS<T> &p_bfs, int p_numColumns, int p_numRows)
+    : m_columns(NumWords(p_numColumns), 0), m_slacks(NumWords(p_numRows), 0)
+  {
+    for (const int key : p_bfs.Keys()) {
+      if (p_bfs[key] == T(0)) {
+        continue;
+      }
+      if (key > 0 && key <= p_numColumns) {
+        Mark(m_columns, key);
+      }
+      else if (key < 0 && -key <= p_numRows) {
+        Mark(m_slacks, -key);
+      }
+    }
+  }
+
+  const Bitset &GetColumns() const { return m_columns; }
+  const Bitset &GetSlacks() const { return m_slacks; }
+
+  /// Returns true if p_test(k) holds for every label k marked in both p_x and p_y
+  template <class F> static bool AllCommon(const Bitset &p_x, const Bitset &p_y, F p_test)
+  {
+    for (size_t w = 0; w < p_x.size(); w++) {
+      for (std::uint64_t common = p_x[w] & p_y[w]; common != 0; common &= common - 1) {
+        if (!p_test(static_cast<int>(w * 64 + std::countr_zero(common)) + 1)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+private:
+  Bitset m_columns, m_slacks;
+
+  static size_t NumWords(int p_labels) { return (p_labels + 63) / 64; }
+  static void Mark(Bitset &p_set, int p_label)
+  {
+    p_set[(p_label - 1) / 64] |= std::uint64_t(1) << ((p_label - 1) % 64);
+  }
+};
+
+} // end anonymous namespace
+
 template <class T>
 Array<Array<MixedStrategyProfile<T>>> EnumMixedStrategySolution<T>::GetCliques() const
 {
@@ -80,7 +140,7 @@ Array<Array<MixedStrategyProfile<T>>> EnumMixedStrategySolution<T>::GetCliques()
 template <class T>
 std::shared_ptr<EnumMixedStrategySolution<T>>
 EnumMixedStrategySolveDetailed(const Game &p_game, StrategyCallbackType<T> p_onEquilibrium,
-                               const CancelToken &p_cancel)
+                               const CancelToken &p_cancel, int p_numThreads)
 {
   if (p_game->NumPlayers() != 2) {
     throw UndefinedException("Method only valid for two-player games.");
@@ -127,15 +187,60 @@ EnumMixedStrategySolveDetailed(const Game &p_game, StrategyCallbackType<T> p_onE
   b1 = (T)-1;
   b2 = (T)-1;
 
-  // enumerate vertices of A1 x + b1 <= 0 and A2 x + b2 <= 0
-  const auto poly1 = EnumerateVertices(A1, b1, p_cancel);
-  const auto poly2 = EnumerateVertices(A2, b2, p_cancel);
+  const int numThreads = GetNumThreads(p_numThreads);
+
+  // enumerate vertices of A1 x + b1 <= 0 and A2 x + b2 <= 0, concurrently
+  VertexEnumerationResult<T> poly1, poly2;
+  ParallelFor(2, numThreads, [&](size_t i) {
+    if (i == 0) {
+      poly1 = EnumerateVertices(A1, b1, p_cancel);
+    }
+    else {
+      poly2 = EnumerateVertices(A2, b2, p_cancel);
+    }
+  });
 
   const auto &verts1(poly1.vertices);
   const auto &verts2(poly2.vertices);
   solution->m_v1 = verts1.size();
   solution->m_v2 = verts2.size();
 
+  const int n1 = p_game->GetPlayer(1)->GetStrategies().size();
+  const int n2 = p_game->GetPlayer(2)->GetStrategies().size();
+  std::vector<VertexLabels> labels1, labels2;
+  labels1.reserve(solution->m_v1);
+  labels2.reserve(solution->m_v2);
+  for (const auto &bfs : verts1) {
+    labels1.emplace_back(bfs, n2, n1);
+  }
+  for (const auto &bfs : verts2) {
+    labels2.emplace_back(bfs, n1, n2);
+  }
+
+  // Find the complementary pairs of vertices.  Each vertex of the second polytope is
+  // paired with all vertices of the first polytope in turn, with these passes spread
+  // over the threads.  The zero vertices of the two polytopes are skipped.
+  std::vector<std::vector<int>> complements(std::max(solution->m_v2 - 1, 0));
+  ParallelFor(complements.size(), numThreads, [&](size_t index) {
+    const int i2 = static_cast<int>(index) + 2;
+    const BFS<T> &bfs1 = verts2[i2];
+    const VertexLabels &label1 = labels2[i2 - 1];
+    for (int i1 = 2; i1 <= solution->m_v1; i1++) {
+      p_cancel.Check();
+      const BFS<T> &bfs2 = verts1[i1];
+      const VertexLabels &label2 = labels1[i1 - 1];
+
+      // check if solution is nash
+      // need only check complementarity, since it is feasible
+      if (VertexLabels::AllCommon(label1.GetColumns(), label2.GetSlacks(),
+                                  [&](int k) { return EqZero(bfs1[k] * bfs2[-k]); }) &&
+          VertexLabels::AllCommon(label2.GetColumns(), label1.GetSlacks(),
+                                  [&](int k) { return EqZero(bfs2[k] * bfs1[-k]); })) {
+        complements[index].push_back(i1);
+      }
+    }
+  });
+
   Array<int> vert1id(solution->m_v1);
   Array<int> vert2id(solution->m_v2);
   std::fill(vert1id.begin(), vert1id.end(), 0);
@@ -145,58 +250,40 @@ EnumMixedStrategySolveDetailed(const Game &p_game, StrategyCallbackType<T> p_onE
 
   for (int i2 = 2; i2 <= solution->m_v2; i2++) {
     const BFS<T> &bfs1 = verts2[i2];
-    for (int i1 = 2; i1 <= solution->m_v1; i1++) {
-      p_cancel.Check();
+    for (const int i1 : complements[i2 - 2]) {
       const BFS<T> &bfs2 = verts1[i1];
-
-      // check if solution is nash
-      // need only check complementarity, since it is feasible
-      bool nash = true;
-      for (size_t k = 1; nash && k <= p_game->GetPlayer(1)->GetStrategies().size(); k++) {
-        if (bfs1.count(k) && bfs2.count(-k)) {
-          nash = EqZero(bfs1[k] * bfs2[-k]);
+      MixedStrategyProfile<T> eqm(p_game->NewMixedStrategyProfile(static_cast<T>(0)));
+      eqm = static_cast<T>(0);
+      for (size_t k = 1; k <= p_game->GetPlayer(1)->GetStrategies().size(); k++) {
+        if (bfs1.count(k)) {
+          eqm[p_game->GetPlayer(1)->GetStrategy(k)] = -bfs1[k];
         }
       }
-      for (size_t k = 1; nash && k <= p_game->GetPlayer(2)->GetStrategies().size(); k++) {
-        if (bfs2.count(k) && bfs1.count(-k)) {
-          nash = EqZero(bfs2[k] * bfs1[-k]);
+      for (size_t k = 1; k <= p_game->GetPlayer(2)->GetStrategies().size(); k++) {
+        if (bfs2.count(k)) {
+          eqm[p_game->GetPlayer(2)->GetStrategy(k)] = -bfs2[k];
         }
       }
+      eqm = eqm.Normalize();
+      solution->m_extremeEquilibria.push_back(eqm);
+      p_onEquilibrium(eqm);
 
-      if (nash) {
-        MixedStrategyProfile<T> eqm(p_game->NewMixedStrategyProfile(static_cast<T>(0)));
-        eqm = static_cast<T>(0);
-        for (size_t k = 1; k <= p_game->GetPlayer(1)->GetStrategies().size(); k++) {
-          if (bfs1.count(k)) {
-            eqm[p_game->GetPlayer(1)->GetStrategy(k)] = -bfs1[k];
-          }
-        }
-        for (size_t k = 1; k <= p_game->GetPlayer(2)->GetStrategies().size(); k++) {
-          if (bfs2.count(k)) {
-            eqm[p_game->GetPlayer(2)->GetStrategy(k)] = -bfs2[k];
-          }
-        }
-        eqm = eqm.Normalize();
-        solution->m_extremeEquilibria.push_back(eqm);
-        p_onEquilibrium(eqm);
-
-        // note: The keys give the mixed strategy associated with each node.
-        //       The keys should also keep track of the basis
-        //       As things stand now, two different bases could lead to
-        //       the same key... BAD!
-        if (vert1id[i1] == 0) {
-          id1++;
-          vert1id[i1] = id1;
-          solution->m_key2.push_back(eqm.GetStrategy(p_game->GetPlayer(2)));
-        }
-        if (vert2id[i2] == 0) {
-          id2++;
-          vert2id[i2] = id2;
-          solution->m_key1.push_back(eqm.GetStrategy(p_game->GetPlayer(1)));
-        }
-        solution->m_node1.push_back(vert2id[i2]);
-        solution->m_node2.push_back(vert1id[i1]);
+      // note: The keys give the mixed strategy associated with each node.
+      //       The keys should also keep track of the basis
+      //       As things stand now, two different bases could lead to
+      //       the same key... BAD!
+      if (vert1id[i1] == 0) {
+        id1++;
+        vert1id[i1] = id1;
+        solution->m_key2.push_back(eqm.GetStrategy(p_game->GetPlayer(2)));
+      }
+      if (vert2id[i2] == 0) {
+        id2++;
+        vert2id[i2] = id2;
+        solution->m_key1.push_back(eqm.GetStrategy(p_game->GetPlayer(1)));
       }
+      solution->m_node1.push_back(vert2id[i2]);
+      solution->m_node2.push_back(vert1id[i1]);
     }
   }
   return solution;
@@ -207,9 +294,9 @@ template class EnumMixedStrategySolution<Rational>;
 
 template std::shared_ptr<EnumMixedStrategySolution<double>>
 EnumMixedStrategySolveDetailed(const Game &p_game, StrategyCallbackType<double> p_onEquilibrium,
-                               const CancelToken &p_cancel);
+                               const CancelToken &p_cancel, int p_numThreads);
 template std::shared_ptr<EnumMixedStrategySolution<Rational>>
 EnumMixedStrategySolveDetailed(const Game &p_game, StrategyCallbackType<Rational> p_onEquilibrium,
-                               const CancelToken &p_cancel);
+                               const CancelToken &p_cancel, int p_numThreads);
 
 } // end namespace Gambit::Nash
@@ -61,19 +61,26 @@ public:
   mutable Array<Array<int>> m_cliques1, m_cliques2;
 };
 
+/// Computes the extreme equilibria of a two-player game, together with the graph
+/// connecting them.  The vertices of the two best-response polytopes are enumerated
+/// concurrently, and the search for complementary pairs of vertices is divided among
+/// up to p_numThreads threads (all available threads if p_numThreads is not positive).
+/// The equilibria found, and the order in which they are reported, do not depend on
+/// the number of threads.
 template <class T>
 std::shared_ptr<EnumMixedStrategySolution<T>>
 EnumMixedStrategySolveDetailed(const Game &p_game,
                                StrategyCallbackType<T> p_onEquilibrium = NullStrategyCallback<T>,
-                               const CancelToken &p_cancel = CancelToken());
+                               const CancelToken &p_cancel = CancelToken(), int p_numThreads = 1);
 
 template <class T>
 std::list<MixedStrategyProfile<T>>
 EnumMixedStrategySolve(const Game &p_game,
                        StrategyCallbackType<T> p_onEquilibrium = NullStrategyCallback<T>,
-                       const CancelToken &p_cancel = CancelToken())
+                       const CancelToken &p_cancel = CancelToken(), int p_numThreads = 1)
 {
-  return EnumMixedStrategySolveDetailed<T>(p_game, p_onEquilibrium, p_cancel)->m_extremeEquilibria;
+  return EnumMixedStrategySolveDetailed<T>(p_game, p_onEquilibrium, p_cancel, p_numThreads)
+      ->m_extremeEquilibria;
 }
 
 } // end namespace Gambit::Nash
@@ -20,6 +20,7 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include "core/parallel.h"
 #include "enumpoly.h"
 #include "solvers/nashsupport/nashsupport.h"
 #include "polysystem.h"
@@ -181,11 +182,12 @@ FindNashExtension(const MixedBehaviorProfile<double> &p_baseProfile, double p_ma
   return std::nullopt;
 }
 
-std::list<MixedBehaviorProfile<double>> SolveSupport(const BehaviorSupportProfile &p_support,
-                                                     bool &p_isSingular, bool &p_budgetExceeded,
-                                                     int p_stopAfter, double p_maxRegret,
-                                                     size_t p_maxRectangles,
-                                                     const CancelToken &p_cancel)
+// Returns an entry for each root found on the support, in the order found, which is
+// empty if the root has no extension to an equilibrium of the game
+std::list<std::optional<MixedBehaviorProfile<double>>>
+SolveSupport(const BehaviorSupportProfile &p_support, bool &p_isSingular, bool &p_budgetExceeded,
+             int p_stopAfter, double p_maxRegret, size_t p_maxRectangles,
+             const CancelToken &p_cancel)
 {
   ProblemData data(p_support);
   PolynomialSystem<double> equations(data.space);
@@ -211,14 +213,11 @@ std::list<MixedBehaviorProfile<double>> SolveSupport(const BehaviorSupportProfil
     p_isSingular = true;
   }
 
-  std::list<MixedBehaviorProfile<double>> solutions;
+  std::list<std::optional<MixedBehaviorProfile<double>>> solutions;
   for (const auto &root : roots) {
     const MixedBehaviorProfile<double> sol(
         data.m_support.ToMixedBehaviorProfile(ToSequenceProbs(data, root)));
-    auto extended = FindNashExtension(sol, p_maxRegret);
-    if (extended.has_value()) {
-      solutions.push_back(extended.value());
-    }
+    solutions.push_back(FindNashExtension(sol, p_maxRegret));
   }
   return solutions;
 }
@@ -231,7 +230,7 @@ std::list<MixedBehaviorProfile<double>>
 EnumPolyBehaviorSolve(const Game &p_game, int p_stopAfter, double p_maxregret,
                       size_t p_maxRectangles, BehaviorCallbackType<double> p_onEquilibrium,
                       EnumPolyEventCallbackType<BehaviorSupportProfile> p_onEvent,
-                      const CancelToken &p_cancel)
+                      const CancelToken &p_cancel, int p_numThreads)
 {
   if (!p_game->IsPerfectRecall()) {
     throw UndefinedException(
@@ -243,31 +242,47 @@ EnumPolyBehaviorSolve(const Game &p_game, int p_stopAfter, double p_maxregret,
     p_maxregret *= scale;
   }
 
+  struct SupportSolution {
+    std::list<std::optional<MixedBehaviorProfile<double>>> roots;
+    bool isSingular{false}, budgetExceeded{false};
+  };
+
   std::list<MixedBehaviorProfile<double>> ret;
   PossibleNashBehaviorSupports possible_supports(p_game);
-
-  for (auto support : possible_supports) {
-    p_cancel.Check();
-    p_onEvent(EnumPolyCandidateSupportEvent<BehaviorSupportProfile>{support});
-    bool isSingular = false;
-    bool budgetExceeded = false;
-    for (const auto &solution :
-         SolveSupport(support, isSingular, budgetExceeded,
-                      std::max(p_stopAfter - static_cast<int>(ret.size()), 0), p_maxregret,
-                      p_maxRectangles, p_cancel)) {
-      p_onEquilibrium(solution);
-      ret.push_back(solution);
-    }
-    if (isSingular) {
-      p_onEvent(EnumPolySingularSupportEvent<BehaviorSupportProfile>{support});
-    }
-    if (budgetExceeded) {
-      p_onEvent(EnumPolyBudgetExceededSupportEvent<BehaviorSupportProfile>{support});
-    }
-    if (p_stopAfter > 0 && static_cast<int>(ret.size()) >= p_stopAfter) {
-      break;
-    }
-  }
+  // As for the strategic form, each support is searched independently for up to
+  // p_stopAfter roots, and the surplus is discarded as the supports are taken in turn.
+  ParallelPipeline(
+      GetNumThreads(p_numThreads), p_cancel,
+      [&possible_supports]() { return possible_supports.Next(); },
+      [&](const BehaviorSupportProfile &support, const CancelToken &cancel) {
+        SupportSolution solution;
+        solution.roots = SolveSupport(support, solution.isSingular, solution.budgetExceeded,
+                                      p_stopAfter, p_maxregret, p_maxRectangles, cancel);
+        return solution;
+      },
+      [&](const BehaviorSupportProfile &support, SupportSolution solution) {
+        p_onEvent(EnumPolyCandidateSupportEvent<BehaviorSupportProfile>{support});
+        if (p_stopAfter > 0) {
+          const size_t sought = p_stopAfter - ret.size();
+          if (solution.roots.size() >= sought) {
+            solution.roots.erase(std::next(solution.roots.begin(), sought), solution.roots.end());
+            solution.budgetExceeded = false;
+          }
+        }
+        for (const auto &root : solution.roots) {
+          if (root) {
+            p_onEquilibrium(*root);
+            ret.push_back(*root);
+          }
+        }
+        if (solution.isSingular) {
+          p_onEvent(EnumPolySingularSupportEvent<BehaviorSupportProfile>{support});
+        }
+        if (solution.budgetExceeded) {
+          p_onEvent(EnumPolyBudgetExceededSupportEvent<BehaviorSupportProfile>{support});
+        }
+        return p_stopAfter <= 0 || static_cast<int>(ret.size()) < p_stopAfter;
+      });
   return ret;
 }
 
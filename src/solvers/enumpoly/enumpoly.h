@@ -61,21 +61,26 @@ template <class Support> void NullEnumPolyEventCallback(const EnumPolyEvent<Supp
 /// for difficult-but-tractable ones while bounding the worst case.
 constexpr size_t kDefaultEnumPolyMaxRectangles = 20'000;
 
+/// Computes the equilibria on each of the supports which may be the support of an
+/// equilibrium.  The supports are solved on up to p_numThreads threads (all available
+/// threads if p_numThreads is not positive).  Equilibria and events are reported in the
+/// calling thread, in the order of the supports, and do not depend on the number of threads.
 std::list<MixedStrategyProfile<double>>
 EnumPolyStrategySolve(const Game &p_game, int p_stopAfter, double p_maxregret,
                       size_t p_maxRectangles = kDefaultEnumPolyMaxRectangles,
                       StrategyCallbackType<double> p_onEquilibrium = NullStrategyCallback<double>,
                       EnumPolyEventCallbackType<StrategySupportProfile> p_onEvent =
                           NullEnumPolyEventCallback<StrategySupportProfile>,
-                      const CancelToken &p_cancel = CancelToken());
+                      const CancelToken &p_cancel = CancelToken(), int p_numThreads = 1);
 
+/// As EnumPolyStrategySolve, but working with supports of behavior strategies
 std::list<MixedBehaviorProfile<double>>
 EnumPolyBehaviorSolve(const Game &, int p_stopAfter, double p_maxregret,
                       size_t p_maxRectangles = kDefaultEnumPolyMaxRectangles,
                       BehaviorCallbackType<double> p_onEquilibrium = NullBehaviorCallback<double>,
                       EnumPolyEventCallbackType<BehaviorSupportProfile> p_onEvent =
                           NullEnumPolyEventCallback<BehaviorSupportProfile>,
-                      const CancelToken &p_cancel = CancelToken());
+                      const CancelToken &p_cancel = CancelToken(), int p_numThreads = 1);
 
 } // namespace Gambit::Nash
 
@@ -63,7 +63,9 @@ public:
         m_end = true;
       }
       else {
-        std::copy(m_current.begin(), cur, m_set->m_lower.begin());
+        // Reset the indices before the one advanced, which are all at their upper bounds
+        const auto lower = m_set->m_lower.begin();
+        std::copy(lower, std::next(lower, cur - m_current.begin()), m_current.begin());
         (*cur)++;
       }
       return *this;
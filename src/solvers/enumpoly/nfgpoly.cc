@@ -23,6 +23,7 @@
 
 #include <numeric>
 
+#include "core/parallel.h"
 #include "games/stratpure.h"
 #include "enumpoly.h"
 #include "solvers/nashsupport/nashsupport.h"
@@ -145,7 +146,7 @@ std::list<MixedStrategyProfile<double>>
 EnumPolyStrategySolve(const Game &p_game, int p_stopAfter, double p_maxregret,
                       size_t p_maxRectangles, StrategyCallbackType<double> p_onEquilibrium,
                       EnumPolyEventCallbackType<StrategySupportProfile> p_onEvent,
-                      const CancelToken &p_cancel)
+                      const CancelToken &p_cancel, int p_numThreads)
 {
   if (!p_game->IsPerfectRecall()) {
     throw UndefinedException(
@@ -157,34 +158,50 @@ EnumPolyStrategySolve(const Game &p_game, int p_stopAfter, double p_maxregret,
     p_maxregret *= scale;
   }
 
+  struct SupportSolution {
+    std::list<MixedStrategyProfile<double>> roots;
+    bool isSingular{false}, budgetExceeded{false};
+  };
+
   std::list<MixedStrategyProfile<double>> ret;
   PossibleNashStrategySupports possible_supports(p_game);
-
-  for (auto support : possible_supports) {
-    p_cancel.Check();
-    p_onEvent(EnumPolyCandidateSupportEvent<StrategySupportProfile>{support});
-    bool is_singular;
-    bool budget_exceeded;
-    for (auto solution : EnumPolyStrategySupportSolve(
-             support, is_singular, budget_exceeded,
-             std::max(p_stopAfter - static_cast<int>(ret.size()), 0), p_maxRectangles, p_cancel)) {
-      const MixedStrategyProfile<double> fullProfile = solution.ToFullSupport();
-      if (fullProfile.GetMaxRegret() < p_maxregret) {
-        p_onEquilibrium(fullProfile);
-        ret.push_back(fullProfile);
-      }
-    }
-
-    if (is_singular) {
-      p_onEvent(EnumPolySingularSupportEvent<StrategySupportProfile>{support});
-    }
-    if (budget_exceeded) {
-      p_onEvent(EnumPolyBudgetExceededSupportEvent<StrategySupportProfile>{support});
-    }
-    if (p_stopAfter > 0 && static_cast<int>(ret.size()) >= p_stopAfter) {
-      break;
-    }
-  }
+  // Each support is searched for up to p_stopAfter roots, independently of the others, so
+  // that the result does not depend on the order in which the supports are finished.  Of
+  // these, only as many are used as would have been sought by searching the supports in turn.
+  ParallelPipeline(
+      GetNumThreads(p_numThreads), p_cancel,
+      [&possible_supports]() { return possible_supports.Next(); },
+      [&](const StrategySupportProfile &support, const CancelToken &cancel) {
+        SupportSolution solution;
+        solution.roots = EnumPolyStrategySupportSolve(support, solution.isSingular,
+                                                      solution.budgetExceeded, p_stopAfter,
+                                                      p_maxRectangles, cancel);
+        return solution;
+      },
+      [&](const StrategySupportProfile &support, SupportSolution solution) {
+        p_onEvent(EnumPolyCandidateSupportEvent<StrategySupportProfile>{support});
+        if (p_stopAfter > 0) {
+          const size_t sought = p_stopAfter - ret.size();
+          if (solution.roots.size() >= sought) {
+            solution.roots.erase(std::next(solution.roots.begin(), sought), solution.roots.end());
+            solution.budgetExceeded = false;
+          }
+        }
+        for (const auto &root : solution.roots) {
+          const MixedStrategyProfile<double> fullProfile = root.ToFullSupport();
+          if (fullProfile.GetMaxRegret() < p_maxregret) {
+            p_onEquilibrium(fullProfile);
+            ret.push_back(fullProfile);
+          }
+        }
+        if (solution.isSingular) {
+          p_onEvent(EnumPolySingularSupportEvent<StrategySupportProfile>{support});
+        }
+        if (solution.budgetExceeded) {
+          p_onEvent(EnumPolyBudgetExceededSupportEvent<StrategySupportProfile>{support});
+        }
+        return p_stopAfter <= 0 || static_cast<int>(ret.size()) < p_stopAfter;
+      });
   return ret;
 }
 
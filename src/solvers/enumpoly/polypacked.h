@@ -0,0 +1,193 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/solvers/enumpoly/polypacked.h
+// Packed representation of polynomials for repeated evaluation
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_SOLVERS_ENUMPOLY_POLYPACKED_H
+#define GAMBIT_SOLVERS_ENUMPOLY_POLYPACKED_H
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "poly.h"
+
+namespace Gambit {
+
+/// @brief A list of polynomials over a common space, packed for repeated evaluation.
+///
+/// Polynomial<T> is suited to building up polynomials, but each of its terms holds a
+/// dense vector of exponents of its own.  Here the terms of all the polynomials are held
+/// together in a few flat arrays, allocated once: the coefficients of the terms, and for
+/// each term only the variables which appear in it, each packed with its exponent into
+/// a single word.  Evaluation then reads contiguous memory and allocates nothing.
+///
+/// Terms are evaluated in the same order and with the same operations as by
+/// Polynomial<T>::Evaluate(), and their derivatives as the terms of
+/// Polynomial<T>::PartialDerivative() would be, so the values computed are identical.
+template <class T> class PackedPolynomials {
+public:
+  PackedPolynomials() = default;
+  /// Packs the polynomials in [p_begin, p_end), which are over a space of dimension p_dimension
+  template <class Iterator>
+  PackedPolynomials(int p_dimension, Iterator p_begin, Iterator p_end) : m_dimension(p_dimension)
+  {
+    for (; p_begin != p_end; ++p_begin) {
+      Append(*p_begin);
+    }
+  }
+  explicit PackedPolynomials(const Polynomial<T> &p_poly) : m_dimension(p_poly.GetDimension())
+  {
+    Append(p_poly);
+  }
+
+  size_t size() const { return m_firstTerm.size() - 1; }
+  int GetDimension() const { return m_dimension; }
+
+  /// Returns true if no variable has an exponent greater than one in polynomial p_index
+  bool IsMultiaffine(size_t p_index) const
+  {
+    return std::all_of(std::next(m_factors.begin(), m_firstFactor[m_firstTerm[p_index]]),
+                       std::next(m_factors.begin(), m_firstFactor[m_firstTerm[p_index + 1]]),
+                       [](std::uint32_t f) { return (f & ExponentMask) <= 1; });
+  }
+  /// Returns the variables (numbered from 1) which appear in polynomial p_index
+  std::vector<int> GetVariables(size_t p_index) const
+  {
+    std::vector<char> appears(m_dimension, 0);
+    for (auto f = m_firstFactor[m_firstTerm[p_index]];
+         f < m_firstFactor[m_firstTerm[p_index + 1]]; ++f) {
+      appears[m_factors[f] >> ExponentBits] = 1;
+    }
+    std::vector<int> variables;
+    for (int i = 0; i < m_dimension; ++i) {
+      if (appears[i]) {
+        variables.push_back(i + 1);
+      }
+    }
+    return variables;
+  }
+
+  /// Returns the value of polynomial p_index at p_point
+  T Evaluate(size_t p_index, const Vector<T> &p_point) const
+  {
+    const auto point = p_point.begin();
+    T value = static_cast<T>(0);
+    for (auto t = m_firstTerm[p_index]; t < m_firstTerm[p_index + 1]; ++t) {
+      T term = m_coefs[t];
+      for (auto f = m_firstFactor[t]; f < m_firstFactor[t + 1]; ++f) {
+        term *= Power(point[m_factors[f] >> ExponentBits], m_factors[f] & ExponentMask);
+      }
+      value += term;
+    }
+    return value;
+  }
+
+  /// Sets each entry of p_values to the value at p_point of the corresponding polynomial,
+  /// and each row of p_derivs to its partial derivatives there.  Only as many of the
+  /// polynomials as there are entries in p_values are evaluated.
+  void EvaluateWithDerivatives(const Vector<T> &p_point, Vector<T> &p_values,
+                               Matrix<T> &p_derivs) const
+  {
+    const auto point = p_point.begin();
+    for (size_t i = 0; i < p_values.size(); ++i) {
+      const int row = static_cast<int>(i) + 1;
+      T value = static_cast<T>(0);
+      for (int j = 1; j <= m_dimension; ++j) {
+        p_derivs(row, j) = static_cast<T>(0);
+      }
+      for (auto t = m_firstTerm[i]; t < m_firstTerm[i + 1]; ++t) {
+        const auto first = m_firstFactor[t], last = m_firstFactor[t + 1];
+        T term = m_coefs[t];
+        for (auto f = first; f < last; ++f) {
+          term *= Power(point[m_factors[f] >> ExponentBits], m_factors[f] & ExponentMask);
+        }
+        value += term;
+        for (auto g = first; g < last; ++g) {
+          const std::uint32_t exponent = m_factors[g] & ExponentMask;
+          T partial = m_coefs[t] * static_cast<T>(exponent);
+          for (auto f = first; f < last; ++f) {
+            const std::uint32_t power = (f == g) ? exponent - 1 : m_factors[f] & ExponentMask;
+            if (power > 0) {
+              partial *= Power(point[m_factors[f] >> ExponentBits], power);
+            }
+          }
+          p_derivs(row, static_cast<int>(m_factors[g] >> ExponentBits) + 1) += partial;
+        }
+      }
+      p_values[row] = value;
+    }
+  }
+
+private:
+  static constexpr int ExponentBits = 8;
+  static constexpr std::uint32_t ExponentMask = (1u << ExponentBits) - 1;
+
+  int m_dimension{0};
+  /// The index of the first term of each polynomial, followed by the total number of terms
+  std::vector<size_t> m_firstTerm{0};
+  std::vector<T> m_coefs;
+  /// The index of the first factor of each term, followed by the total number of factors
+  std::vector<size_t> m_firstFactor{0};
+  /// The variable (numbered from 0) of each factor, shifted by ExponentBits, or-ed with
+  /// its exponent
+  std::vector<std::uint32_t> m_factors;
+
+  /// Computes p_base to the power p_exp as Monomial<T> does
+  static T Power(T p_base, std::uint32_t p_exp)
+  {
+    if (p_exp == 1) {
+      return p_base;
+    }
+    T result = static_cast<T>(1);
+    while (p_exp > 0) {
+      if (p_exp & 1) {
+        result *= p_base;
+      }
+      p_base *= p_base;
+      p_exp >>= 1;
+    }
+    return result;
+  }
+
+  void Append(const Polynomial<T> &p_poly)
+  {
+    for (const auto &term : p_poly.GetTerms()) {
+      m_coefs.push_back(term.Coef());
+      std::uint32_t variable = 0;
+      for (const int exponent : term) {
+        if (exponent > 0) {
+          if (exponent > static_cast<int>(ExponentMask)) {
+            throw std::overflow_error("Exponent too large to pack in polynomial");
+          }
+          m_factors.push_back((variable << ExponentBits) | static_cast<std::uint32_t>(exponent));
+        }
+        ++variable;
+      }
+      m_firstFactor.push_back(m_factors.size());
+    }
+    m_firstTerm.push_back(m_coefs.size());
+  }
+};
+
+} // end namespace Gambit
+
+#endif // GAMBIT_SOLVERS_ENUMPOLY_POLYPACKED_H
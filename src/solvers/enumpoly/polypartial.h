@@ -28,6 +28,7 @@
 #include "core/core.h"
 #include "rectangle.h"
 #include "polysystem.h"
+#include "polypacked.h"
 
 namespace Gambit {
 
@@ -44,15 +45,26 @@ private:
   };
 
   Node m_treeroot;
+  /// The root polynomial, packed for evaluation, and the variables which appear in it
+  PackedPolynomials<T> m_root;
+  std::vector<int> m_rootVariables;
+  bool m_rootMultiaffine;
 
   void BuildTree(Node &);
   T MaximalNonconstantContribution(const Node &, const Vector<T> &, const Vector<T> &,
                                    Vector<int> &) const;
+  template <class F> bool AtAllVertices(const Rectangle<T> &, F p_predicate) const;
 
 public:
-  explicit PolynomialDerivatives(const Polynomial<T> &given) : m_treeroot(given)
+  /// The higher partial derivatives are only used for polynomials which are not
+  /// multiaffine, and so are only generated for those.
+  explicit PolynomialDerivatives(const Polynomial<T> &given)
+    : m_treeroot(given), m_root(given), m_rootVariables(m_root.GetVariables(0)),
+      m_rootMultiaffine(m_root.IsMultiaffine(0))
   {
-    BuildTree(m_treeroot);
+    if (!m_rootMultiaffine) {
+      BuildTree(m_treeroot);
+    }
   }
   PolynomialDerivatives(const PolynomialDerivatives<T> &) = default;
   ~PolynomialDerivatives() = default;
@@ -61,8 +73,7 @@ public:
 
   T MaximalNonconstantContribution(const Vector<T> &, const Vector<T> &) const;
 
-  T ValueOfRootPoly(const Vector<T> &point) const { return m_treeroot.data.Evaluate(point); }
-  T ValueOfPartialOfRootPoly(int, const Vector<T> &) const;
+  T ValueOfRootPoly(const Vector<T> &point) const { return m_root.Evaluate(0, point); }
   bool PolyHasNoRootsIn(const Rectangle<T> &) const;
   bool MultiaffinePolyHasNoRootsIn(const Rectangle<T> &) const;
   bool PolyEverywhereNegativeIn(const Rectangle<T> &) const;
@@ -72,12 +83,15 @@ public:
 template <class T> class PolynomialSystemDerivatives {
 private:
   std::list<PolynomialDerivatives<T>> m_system;
+  /// The root polynomials, packed together for evaluation with their first derivatives
+  PackedPolynomials<T> m_roots;
 
 public:
   using iterator = typename std::list<PolynomialDerivatives<T>>::iterator;
   using const_iterator = typename std::list<PolynomialDerivatives<T>>::const_iterator;
 
   explicit PolynomialSystemDerivatives(const PolynomialSystem<T> &given)
+    : m_roots(given.GetDimension(), given.begin(), given.end())
   {
     for (const auto &p : given) {
       m_system.push_back(PolynomialDerivatives<T>(p));
@@ -102,6 +116,13 @@ public:
   Matrix<T> DerivativeMatrix(const Vector<T> &, int) const;
   Matrix<T> SquareDerivativeMatrix(const Vector<T> &) const;
   Vector<T> ValuesOfRootPolys(const Vector<T> &, int) const;
+  /// Computes the values of the first p_values.size() root polynomials at a point,
+  /// together with the matrix of their partial derivatives, in a single pass
+  void ValuesAndDerivativeMatrix(const Vector<T> &p_point, Vector<T> &p_values,
+                                 Matrix<T> &p_derivs) const
+  {
+    m_roots.EvaluateWithDerivatives(p_point, p_values, p_derivs);
+  }
 };
 
 } // namespace Gambit
@@ -161,15 +161,17 @@ bool PolynomialSystemSolver::HasNoOtherRootsIn(const Rectangle<double> &r,
 
 Vector<double> PolynomialSystemSolver::NewtonStep(const Vector<double> &point) const
 {
-  const Vector<double> evals = m_derivatives.ValuesOfRootPolys(point, NumEquations());
-  const Matrix<double> deriv = m_derivatives.DerivativeMatrix(point, NumEquations());
+  Vector<double> evals(NumEquations());
+  Matrix<double> deriv(NumEquations(), GetDimension());
+  m_derivatives.ValuesAndDerivativeMatrix(point, evals, deriv);
   return point - LUFactorization(deriv).Solve(evals);
 }
 
 Vector<double> PolynomialSystemSolver::ImprovingNewtonStep(const Vector<double> &point) const
 {
-  const Vector<double> evals = m_derivatives.ValuesOfRootPolys(point, NumEquations());
-  const Matrix<double> deriv = m_derivatives.DerivativeMatrix(point, NumEquations());
+  Vector<double> evals(NumEquations());
+  Matrix<double> deriv(NumEquations(), GetDimension());
+  m_derivatives.ValuesAndDerivativeMatrix(point, evals, deriv);
   const Vector<double> delta = LUFactorization(deriv).Solve(evals);
 
   double scale = 1.0;
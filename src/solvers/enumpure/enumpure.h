@@ -23,8 +23,10 @@
 #ifndef GAMBIT_SOLVERS_ENUMPURE_ENUMPURE_H
 #define GAMBIT_SOLVERS_ENUMPURE_ENUMPURE_H
 
+#include "core/parallel.h"
 #include "games/stratpure.h"
 #include "games/behavpure.h"
+#include "games/gametable.h"
 #include "solvers/nash.h"
 
 namespace Gambit::Nash {
@@ -42,19 +44,115 @@ inline bool IsNash(const PureStrategyProfile &p_profile)
   return true;
 }
 
+/// Clears the entries of p_bestResponse for contingencies at which the player whose
+/// payoffs are p_payoffs is not playing a best response, where p_mode is the index of
+/// that player's strategies in the table.  Each line of the table along p_mode is
+/// scanned once to find the best payoff against it, and then again to compare each
+/// entry to it.  Lines are processed in blocks which are distributed over p_numThreads.
+inline void MarkBestResponses(const CartesianTensor<Rational> &p_payoffs, size_t p_mode,
+                              std::vector<unsigned char> &p_bestResponse, int p_numThreads,
+                              const CancelToken &p_cancel)
+{
+  // Number of adjacent lines handled together, which are contiguous in memory
+  constexpr size_t block = 1024;
+  const size_t radix = p_payoffs.m_space->m_radices[p_mode];
+  const size_t stride = p_payoffs.m_space->m_strides[p_mode];
+  const size_t numOuter = p_payoffs.m_data.size() / (stride * radix);
+  const size_t numBlocks = (stride + block - 1) / block;
+  ParallelFor(numOuter * numBlocks, p_numThreads, [&](size_t p_index) {
+    if (p_cancel.IsCanceled()) {
+      return;
+    }
+    const size_t begin = (p_index / numBlocks) * stride * radix + (p_index % numBlocks) * block;
+    const size_t length = std::min(block, stride - (p_index % numBlocks) * block);
+    const Rational *payoffs = p_payoffs.m_data.data() + begin;
+    std::vector<const Rational *> best(length);
+    for (size_t i = 0; i < length; ++i) {
+      best[i] = payoffs + i;
+    }
+    for (size_t s = 1; s < radix; ++s) {
+      const Rational *line = payoffs + s * stride;
+      for (size_t i = 0; i < length; ++i) {
+        if (line[i] > *best[i]) {
+          best[i] = line + i;
+        }
+      }
+    }
+    for (size_t s = 0; s < radix; ++s) {
+      const Rational *line = payoffs + s * stride;
+      unsigned char *marks = p_bestResponse.data() + begin + s * stride;
+      for (size_t i = 0; i < length; ++i) {
+        if (marks[i] && line[i] != *best[i]) {
+          marks[i] = 0;
+        }
+      }
+    }
+  });
+  p_cancel.Check();
+}
+
+///
+/// Enumerate pure-strategy Nash equilibria of a game in strategic form, working
+/// directly on its payoff tables.  For each player, the contingencies at which
+/// that player is playing a best response are found in a sweep over their payoff
+/// table; the equilibria are the contingencies marked in every sweep.  Each
+/// sweep is split over p_numThreads threads (all available threads if zero or
+/// negative).  Equilibria are reported in the same order as by enumerating the
+/// contingencies of the game.
+///
+inline std::list<MixedStrategyProfile<Rational>>
+EnumPureTableSolve(const Game &p_game,
+                   StrategyCallbackType<Rational> p_onEquilibrium = NullStrategyCallback<Rational>,
+                   const CancelToken &p_cancel = CancelToken(), int p_numThreads = 1)
+{
+  const auto &table = dynamic_cast<const GameTableRep &>(*p_game);
+  const int numThreads = GetNumThreads(p_numThreads);
+  std::vector<unsigned char> equilibrium;
+  for (const auto &player : p_game->GetPlayers()) {
+    const auto &payoffs = table.GetPayoffTensor<Rational>(player->GetNumber());
+    if (equilibrium.empty()) {
+      equilibrium.assign(payoffs.m_data.size(), 1);
+    }
+    MarkBestResponses(payoffs, player->GetNumber() - 1, equilibrium, numThreads, p_cancel);
+  }
+
+  std::list<MixedStrategyProfile<Rational>> solutions;
+  const auto &space = *table.GetPayoffTensor<Rational>(1).m_space;
+  for (size_t index = 0; index < equilibrium.size(); ++index) {
+    if (!equilibrium[index]) {
+      continue;
+    }
+    p_cancel.Check();
+    auto profile = p_game->NewPureStrategyProfile();
+    for (const auto &player : p_game->GetPlayers()) {
+      const size_t mode = player->GetNumber() - 1;
+      profile->SetStrategy(
+          player->GetStrategy((index / space.m_strides[mode]) % space.m_radices[mode] + 1));
+    }
+    solutions.push_back(profile->ToMixedStrategyProfile());
+    p_onEquilibrium(solutions.back());
+  }
+  return solutions;
+}
+
 ///
 /// Enumerate pure-strategy Nash equilibria of a game.  By definition,
 /// pure-strategy equilibrium uses the strategic representation of a game.
+/// Games in strategic form are solved using EnumPureTableSolve, with up to
+/// p_numThreads threads; for other games, each contingency is checked in turn.
 ///
 inline std::list<MixedStrategyProfile<Rational>> EnumPureStrategySolve(
     const Game &p_game,
     StrategyCallbackType<Rational> p_onEquilibrium = NullStrategyCallback<Rational>,
-    const CancelToken &p_cancel = CancelToken())
+    const CancelToken &p_cancel = CancelToken(), int p_numThreads = 1)
 {
   if (!p_game->IsPerfectRecall()) {
     throw UndefinedException(
         "Computing equilibria of games with imperfect recall is not supported.");
   }
+  if (dynamic_cast<const GameTableRep *>(p_game.get())) {
+    return EnumPureTableSolve(p_game, p_onEquilibrium, p_cancel, p_numThreads);
+  }
   std::list<MixedStrategyProfile<Rational>> solutions;
   for (const auto &profile : StrategyContingencies(p_game)) {
     p_cancel.Check();
@@ -83,6 +181,222 @@ inline bool IsAgentNash(const PureBehaviorProfile &p_profile)
   return true;
 }
 
+///
+/// Evaluates pure behavior profiles of a game tree in which no play passes through
+/// an information set more than once, and the unilateral deviations from them at a
+/// single information set.
+///
+/// The value to each player of every node of the tree, given the current profile,
+/// is cached.  When the action at an information set is changed, only the values of
+/// its members and of those of their ancestors whose values depend on them are
+/// recomputed.  The payoff to a deviation at an information set is then found from
+/// the cached values of the children of its members, weighted by the probabilities
+/// of reaching the members, without re-walking the tree.
+///
+class AgentDeviationEvaluator {
+public:
+  explicit AgentDeviationEvaluator(const Game &p_game)
+    : m_numPlayers(p_game->NumPlayers()), m_numNodes(p_game->NumNodes())
+  {
+    m_offsets.assign(m_numPlayers + 1, 0);
+    for (const auto &player : p_game->GetPlayersWithChance()) {
+      m_offsets[player->GetNumber()] = m_infosets.size();
+      for (const auto &infoset : player->GetInfosets()) {
+        m_infosets.push_back({(player->IsChance()) ? -1 : player->GetNumber() - 1,
+                              static_cast<int>(infoset->GetActions().size()),
+                              0,
+                              {}});
+      }
+    }
+
+    m_parent.assign(m_numNodes, -1);
+    m_priorAction.assign(m_numNodes, -1);
+    m_infoset.assign(m_numNodes, -1);
+    m_firstChild.assign(m_numNodes + 1, 0);
+    m_payoffs.assign(m_numNodes * m_numPlayers, Rational(0));
+    for (const auto &node : p_game->GetNodes()) {
+      const int index = node->GetNumber() - 1;
+      if (const auto outcome = node->GetOutcome()) {
+        for (const auto &player : p_game->GetPlayers()) {
+          m_payoffs[index * m_numPlayers + player->GetNumber() - 1] =
+              outcome->GetPayoff<Rational>(player);
+        }
+      }
+      m_firstChild[index] = m_children.size();
+      if (node->IsTerminal()) {
+        continue;
+      }
+      const auto infoset = node->GetInfoset();
+      m_infoset[index] = GetInfosetIndex(infoset);
+      m_infosets[m_infoset[index]].m_members.push_back(index);
+      for (const auto &[action, child] : node->GetActions()) {
+        const int childIndex = child->GetNumber() - 1;
+        m_parent[childIndex] = index;
+        m_priorAction[childIndex] = action->GetNumber() - 1;
+        m_children.push_back(childIndex);
+        m_probs.push_back((infoset->IsChanceInfoset())
+                              ? static_cast<Rational>(infoset->GetActionProb(action))
+                              : Rational(0));
+      }
+    }
+    m_firstChild[m_numNodes] = m_children.size();
+
+    // Nodes are numbered in preorder, so children are visited before their parents
+    m_values.resize(m_numNodes * m_numPlayers);
+    for (int node = m_numNodes - 1; node >= 0; --node) {
+      ComputeValue(node);
+    }
+  }
+
+  /// Sets the action at the information set of p_action
+  void SetAction(const GameAction &p_action)
+  {
+    auto &infoset = m_infosets[GetInfosetIndex(p_action->GetInfoset())];
+    const int action = p_action->GetNumber() - 1;
+    if (infoset.m_action == action) {
+      return;
+    }
+    infoset.m_action = action;
+    // Members are listed in preorder; visiting them in reverse ensures that if one
+    // member is an ancestor of another, its value is recomputed last.
+    for (auto member = infoset.m_members.rbegin(); member != infoset.m_members.rend();
+         ++member) {
+      ComputeValue(*member);
+      for (int node = *member; m_parent[node] >= 0; node = m_parent[node]) {
+        const int parent = m_parent[node];
+        const auto &parentInfoset = m_infosets[m_infoset[parent]];
+        if (parentInfoset.m_player >= 0 && parentInfoset.m_action != m_priorAction[node]) {
+          break;
+        }
+        ComputeValue(parent);
+      }
+    }
+  }
+
+  /// Returns whether the current profile is an agent Nash equilibrium, that is, whether
+  /// no player can improve their payoff by changing the action at one information set
+  bool IsAgentNash() const
+  {
+    std::vector<Rational> reach;
+    for (const auto &infoset : m_infosets) {
+      if (infoset.m_player < 0) {
+        continue;
+      }
+      reach.resize(infoset.m_members.size());
+      bool reached = false;
+      for (size_t i = 0; i < infoset.m_members.size(); ++i) {
+        reach[i] = GetReachProb(infoset.m_members[i]);
+        reached = reached || reach[i] != Rational(0);
+      }
+      if (!reached) {
+        continue;
+      }
+      const Rational current = GetActionValue(infoset, infoset.m_action, reach);
+      for (int action = 0; action < infoset.m_numActions; ++action) {
+        if (action != infoset.m_action && GetActionValue(infoset, action, reach) > current) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /// Returns the index of the action currently played at p_infoset (0-based)
+  int GetAction(const GameInfoset &p_infoset) const
+  {
+    return m_infosets[GetInfosetIndex(p_infoset)].m_action;
+  }
+
+private:
+  struct Infoset {
+    /// The index of the player (0-based), or -1 for chance
+    int m_player;
+    int m_numActions;
+    /// The index of the action currently played (0-based)
+    int m_action;
+    /// The nodes in the information set, in preorder
+    std::vector<int> m_members;
+  };
+
+  size_t m_numPlayers, m_numNodes;
+  std::vector<Infoset> m_infosets;
+  /// The index in m_infosets of the first information set of each player, by number
+  std::vector<int> m_offsets;
+  /// For each node: its parent, the index of the action leading to it, and its
+  /// information set (-1 if the node is the root, or is terminal, respectively)
+  std::vector<int> m_parent, m_priorAction, m_infoset;
+  /// The children of node n are m_children[m_firstChild[n]..m_firstChild[n+1]), with
+  /// the probabilities of reaching them from chance nodes in m_probs
+  std::vector<int> m_firstChild, m_children;
+  std::vector<Rational> m_probs;
+  /// Payoffs at, and values of, each node, with players varying fastest
+  std::vector<Rational> m_payoffs, m_values;
+
+  int GetInfosetIndex(const GameInfoset &p_infoset) const
+  {
+    const int player = p_infoset->GetPlayer()->GetNumber();
+    return m_offsets.at(player) + p_infoset->GetNumber() - 1;
+  }
+
+  void ComputeValue(int p_node)
+  {
+    Rational *value = m_values.data() + p_node * m_numPlayers;
+    std::copy_n(m_payoffs.data() + p_node * m_numPlayers, m_numPlayers, value);
+    if (m_infoset[p_node] < 0) {
+      return;
+    }
+    const auto &infoset = m_infosets[m_infoset[p_node]];
+    if (infoset.m_player >= 0) {
+      const Rational *child =
+          m_values.data() + m_children[m_firstChild[p_node] + infoset.m_action] * m_numPlayers;
+      for (size_t pl = 0; pl < m_numPlayers; ++pl) {
+        value[pl] += child[pl];
+      }
+      return;
+    }
+    for (int c = m_firstChild[p_node]; c < m_firstChild[p_node + 1]; ++c) {
+      const Rational *child = m_values.data() + m_children[c] * m_numPlayers;
+      for (size_t pl = 0; pl < m_numPlayers; ++pl) {
+        value[pl] += m_probs[c] * child[pl];
+      }
+    }
+  }
+
+  /// Returns the probability of reaching p_node under the current profile
+  Rational GetReachProb(int p_node) const
+  {
+    Rational prob(1);
+    for (int node = p_node; m_parent[node] >= 0; node = m_parent[node]) {
+      const int parent = m_parent[node];
+      const auto &infoset = m_infosets[m_infoset[parent]];
+      if (infoset.m_player >= 0) {
+        if (infoset.m_action != m_priorAction[node]) {
+          return Rational(0);
+        }
+      }
+      else {
+        prob *= m_probs[m_firstChild[parent] + m_priorAction[node]];
+      }
+    }
+    return prob;
+  }
+
+  /// Returns the payoff to the player at p_infoset from playing p_action there, weighted
+  /// by the probability of reaching the information set
+  Rational GetActionValue(const Infoset &p_infoset, int p_action,
+                          const std::vector<Rational> &p_reach) const
+  {
+    Rational value(0);
+    for (size_t i = 0; i < p_infoset.m_members.size(); ++i) {
+      if (p_reach[i] != Rational(0)) {
+        const int child = m_children[m_firstChild[p_infoset.m_members[i]] + p_action];
+        value += p_reach[i] * m_values[child * m_numPlayers + p_infoset.m_player];
+      }
+    }
+    return value;
+  }
+};
+
 ///
 /// Enumerate pure-strategy agent Nash equilibria of a game.  This uses
 /// the extensive representation.  Agent Nash equilibria are not necessarily
@@ -90,17 +404,63 @@ inline bool IsAgentNash(const PureBehaviorProfile &p_profile)
 /// set (rather than possible deviations by the same player at multiple
 /// information sets.
 ///
+/// Contingencies are visited in the same order as BehaviorContingencies.
+/// Unless some play passes through an information set more than once, they
+/// are checked using an AgentDeviationEvaluator, which is updated as each
+/// action changes.
+///
 inline std::list<MixedBehaviorProfile<Rational>>
 EnumPureAgentSolve(const Game &p_game,
                    BehaviorCallbackType<Rational> p_onEquilibrium = NullBehaviorCallback<Rational>)
 {
   std::list<MixedBehaviorProfile<Rational>> solutions;
   const BehaviorSupportProfile support(p_game);
-  for (auto citer : BehaviorContingencies(BehaviorSupportProfile(p_game))) {
-    if (IsAgentNash(citer)) {
-      solutions.push_back(citer.ToMixedBehaviorProfile());
+  if (!p_game->IsTree() || !p_game->GetAbsentMindedReentries().empty()) {
+    for (auto citer : BehaviorContingencies(support)) {
+      if (IsAgentNash(citer)) {
+        solutions.push_back(citer.ToMixedBehaviorProfile());
+        p_onEquilibrium(solutions.back());
+      }
+    }
+    return solutions;
+  }
+
+  AgentDeviationEvaluator evaluator(p_game);
+  std::vector<GameInfoset> infosets;
+  for (const auto &player : p_game->GetPlayers()) {
+    for (const auto &infoset : player->GetInfosets()) {
+      evaluator.SetAction(infoset->GetAction(1));
+      if (support.IsReachable(infoset)) {
+        infosets.push_back(infoset);
+      }
+    }
+  }
+  std::vector<size_t> position(infosets.size(), 0);
+  while (true) {
+    if (evaluator.IsAgentNash()) {
+      PureBehaviorProfile profile(p_game);
+      for (const auto &player : p_game->GetPlayers()) {
+        for (const auto &infoset : player->GetInfosets()) {
+          profile.SetAction(infoset->GetAction(evaluator.GetAction(infoset) + 1));
+        }
+      }
+      solutions.push_back(profile.ToMixedBehaviorProfile());
       p_onEquilibrium(solutions.back());
     }
+    // Advance to the next contingency, with the last information set varying fastest
+    size_t k = infosets.size();
+    for (; k > 0; --k) {
+      const auto &infoset = infosets[k - 1];
+      if (++position[k - 1] < infoset->GetActions().size()) {
+        evaluator.SetAction(infoset->GetAction(position[k - 1] + 1));
+        break;
+      }
+      position[k - 1] = 0;
+      evaluator.SetAction(infoset->GetAction(1));
+    }
+    if (k == 0) {
+      break;
+    }
   }
   return solutions;
 }
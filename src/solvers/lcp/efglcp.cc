@@ -81,10 +81,9 @@ struct ColumnIndexMap {
   }
 };
 
-template <class T> Matrix<T> ConstructMatrix(const ColumnIndexMap &p_indexMap)
+template <class T> linalg::SparseMatrix<T> ConstructMatrix(const ColumnIndexMap &p_indexMap)
 {
-  Matrix<T> A(1, p_indexMap.total, 0, p_indexMap.total);
-  A = T{0};
+  linalg::SparseMatrix<T> A(1, p_indexMap.total, 0, p_indexMap.total);
 
   const Game &game = p_indexMap.game;
   const GamePlayer player1 = game->GetPlayer(1);
@@ -98,15 +97,14 @@ template <class T> Matrix<T> ConstructMatrix(const ColumnIndexMap &p_indexMap)
   // payoff each player receives when that pair is exactly realised,
   // shifted by payoffShift and weighted by chance's probability of that
   // pair actually being realised (which need not be 1 -- see
-  // PureSequenceProfile::GetRealizationProbability).
-  for (auto profile : game->GetSequenceContingencies()) {
-    const GameSequence &seq1 = profile.GetSequence(player1);
-    const GameSequence &seq2 = profile.GetSequence(player2);
-    const Rational prob = profile.GetRealizationProbability();
-    const Rational pay1 = profile.GetPayoff(player1) - payoffShift * prob;
-    const Rational pay2 = profile.GetPayoff(player2) - payoffShift * prob;
-    A(p_indexMap.index.at(seq1), p_indexMap.index.at(seq2)) = static_cast<T>(pay1);
-    A(p_indexMap.index.at(seq2), p_indexMap.index.at(seq1)) = static_cast<T>(pay2);
+  // PureSequenceProfile::GetRealizationProbability).  Only the pairs
+  // realised at some terminal node have nonzero entries.
+  for (const auto &entry : GetSequenceFormEntries(game)) {
+    const int idx1 = p_indexMap.index.at(entry.m_sequences[0]);
+    const int idx2 = p_indexMap.index.at(entry.m_sequences[1]);
+    const Rational shift = payoffShift * entry.m_probability;
+    A.Set(idx1, idx2, static_cast<T>(entry.m_payoffs[0] - shift));
+    A.Set(idx2, idx1, static_cast<T>(entry.m_payoffs[1] - shift));
   }
 
   // Constraint block: for each information set, the sum-to-one relation
@@ -117,12 +115,12 @@ template <class T> Matrix<T> ConstructMatrix(const ColumnIndexMap &p_indexMap)
       const int infosetIdx = p_indexMap.infosetIndex.at(infoset);
       const auto children = infoset->GetSequences();
       const int arrivalIdx = p_indexMap.index.at(children.front()->GetParent());
-      A(arrivalIdx, infosetIdx) = T{-1};
-      A(infosetIdx, arrivalIdx) = T{1};
+      A.Set(arrivalIdx, infosetIdx, T{-1});
+      A.Set(infosetIdx, arrivalIdx, T{1});
       for (const auto &child : children) {
         const int childIdx = p_indexMap.index.at(child);
-        A(childIdx, infosetIdx) = T{1};
-        A(infosetIdx, childIdx) = T{-1};
+        A.Set(childIdx, infosetIdx, T{1});
+        A.Set(infosetIdx, childIdx, T{-1});
       }
     }
   }
@@ -130,15 +128,15 @@ template <class T> Matrix<T> ConstructMatrix(const ColumnIndexMap &p_indexMap)
   // Column 0 and the two "root anchor" entries are the standard
   // sequence-form LCP fixtures that anchor the probability of each
   // player's empty sequence at 1.
-  for (int i = A.MinRow(); i <= A.MaxRow(); i++) {
-    A(i, 0) = T{-1};
-  }
+  Vector<T> covering(A.MinRow(), A.MaxRow());
+  covering = T{-1};
+  A.SetColumn(0, covering);
   const GameSequence root1 = player1->GetSequences().front();
   const GameSequence root2 = player2->GetSequences().front();
-  A(p_indexMap.index.at(root1), p_indexMap.rootIndex1) = T{1};
-  A(p_indexMap.rootIndex1, p_indexMap.index.at(root1)) = T{-1};
-  A(p_indexMap.index.at(root2), p_indexMap.rootIndex2) = T{1};
-  A(p_indexMap.rootIndex2, p_indexMap.index.at(root2)) = T{-1};
+  A.Set(p_indexMap.index.at(root1), p_indexMap.rootIndex1, T{1});
+  A.Set(p_indexMap.rootIndex1, p_indexMap.index.at(root1), T{-1});
+  A.Set(p_indexMap.index.at(root2), p_indexMap.rootIndex2, T{1});
+  A.Set(p_indexMap.rootIndex2, p_indexMap.index.at(root2), T{-1});
 
   return A;
 }
@@ -27,11 +27,27 @@
 
 namespace Gambit::Nash {
 
+/// Computes the equilibria accessible by Lemke-Howson paths from the extraneous
+/// solution.  With p_numThreads greater than one, the paths are followed on that many
+/// threads; the equilibria found, and the order in which they are reported, are the
+/// same as with one, although in floating point their probabilities may differ by
+/// rounding.
 template <class T>
 std::list<MixedStrategyProfile<T>>
 LcpStrategySolve(const Game &p_game, int p_stopAfter, int p_maxDepth,
                  StrategyCallbackType<T> p_onEquilibrium = NullStrategyCallback<T>,
-                 const CancelToken &p_cancel = CancelToken());
+                 const CancelToken &p_cancel = CancelToken(), int p_numThreads = 1);
+
+/// Computes equilibria as LcpStrategySolve<Rational> does, but following the Lemke
+/// paths in floating-point arithmetic.  Each new equilibrium basis found is certified
+/// by solving for it exactly; paths which fail, for numerical reasons, to reach an
+/// equilibrium basis are followed again in exact arithmetic.  In degenerate games,
+/// the equilibria reached may differ from those found in exact arithmetic throughout.
+std::list<MixedStrategyProfile<Rational>>
+LcpStrategySolveHybrid(const Game &p_game, int p_stopAfter, int p_maxDepth,
+                       StrategyCallbackType<Rational> p_onEquilibrium =
+                           NullStrategyCallback<Rational>,
+                       const CancelToken &p_cancel = CancelToken());
 
 template <class T>
 std::list<MixedBehaviorProfile<T>>
@@ -21,8 +21,17 @@
 //
 
 #include <algorithm>
+#include <condition_variable>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
 
 #include "games.h"
+#include "core/parallel.h"
 #include "solvers/linalg/lhtab.h"
 #include "solvers/lcp/lcp.h"
 
@@ -109,32 +118,64 @@ template <class T> Vector<T> Make_b2(const Game &p_game)
   return b2;
 }
 
+/// Hashes a basis, given as the set of labels of its basic variables
+struct BasisHash {
+  size_t operator()(const std::set<int> &p_labels) const
+  {
+    size_t hash = p_labels.size();
+    for (const int label : p_labels) {
+      hash ^= std::hash<int>()(label) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+  }
+};
+
 } // end anonymous namespace
 
 template <class T> class NashLcpStrategySolver {
 public:
   NashLcpStrategySolver(int p_stopAfter, int p_maxDepth,
                         StrategyCallbackType<T> p_onEquilibrium = NullStrategyCallback<T>,
-                        const CancelToken &p_cancel = CancelToken())
+                        const CancelToken &p_cancel = CancelToken(), int p_numThreads = 1)
     : m_onEquilibrium(p_onEquilibrium), m_stopAfter(p_stopAfter), m_maxDepth(p_maxDepth),
-      m_cancel(p_cancel)
+      m_cancel(p_cancel), m_numThreads(p_numThreads)
   {
   }
   ~NashLcpStrategySolver() = default;
 
   std::list<MixedStrategyProfile<T>> Solve(const Game &) const;
+  /// Follows Lemke paths in floating-point arithmetic, certifying each new CBFS
+  /// in exact arithmetic.  Defined only for T = Rational.
+  std::list<MixedStrategyProfile<T>> SolveHybrid(const Game &) const;
 
 private:
   enum class SearchResult { Continue, PruneBranch, LimitReached };
+  enum class PathResult { Certified, Known, Failed };
+
+  /// Floating-point paths longer than this many pivots per row of the tableau are
+  /// taken to be cycling, and are followed again in exact arithmetic
+  static constexpr int MaxPivotsPerRow = 100;
 
   StrategyCallbackType<T> m_onEquilibrium;
   int m_stopAfter, m_maxDepth;
   CancelToken m_cancel;
+  int m_numThreads;
 
   class Solution;
+  class LemkeGraph;
 
-  SearchResult OnBFS(const Game &, linalg::LHTableau<T> &, Solution &) const;
+  SearchResult OnBFS(const Game &, const linalg::BFS<T> &, Solution &) const;
   SearchResult AllLemke(const Game &, int j, linalg::LHTableau<T> &, Solution &, int) const;
+  SearchResult AllLemkeParallel(const Game &, LemkeGraph &, size_t, int j, Solution &,
+                                int) const;
+
+  PathResult FollowApproximatePath(int, linalg::LHTableau<double> &,
+                                   const linalg::LHTableau<T> &,
+                                   std::optional<linalg::LHTableau<T>> &, const Solution &) const;
+  void FollowHybridPath(int, std::optional<linalg::LHTableau<double>> &,
+                        std::optional<linalg::LHTableau<T>> &) const;
+  SearchResult AllLemkeHybrid(const Game &, int j, const linalg::LHTableau<double> *,
+                              linalg::LHTableau<T> &, Solution &, int) const;
 };
 
 template <class T> class NashLcpStrategySolver<T>::Solution {
@@ -142,12 +183,13 @@ public:
   Array<linalg::BFS<T>> m_bfsList;
   std::list<MixedStrategyProfile<T>> m_equilibria;
 
-  bool Contains(const Gambit::linalg::BFS<T> &p_bfs) const
+  bool Contains(const std::set<int> &p_keys) const
   {
-    const auto keys = p_bfs.Keys();
-    return std::any_of(m_bfsList.begin(), m_bfsList.end(),
-                       [&keys](const Gambit::linalg::BFS<T> &bfs) { return bfs.Keys() == keys; });
+    return std::any_of(
+        m_bfsList.begin(), m_bfsList.end(),
+        [&p_keys](const Gambit::linalg::BFS<T> &bfs) { return bfs.Keys() == p_keys; });
   }
+  bool Contains(const Gambit::linalg::BFS<T> &p_bfs) const { return Contains(p_bfs.Keys()); }
   void push_back(const Gambit::linalg::BFS<T> &p_bfs) { m_bfsList.push_back(p_bfs); }
 
   int EquilibriumCount() const { return m_equilibria.size(); }
@@ -162,10 +204,9 @@ public:
 //
 template <class T>
 typename NashLcpStrategySolver<T>::SearchResult
-NashLcpStrategySolver<T>::OnBFS(const Game &p_game, linalg::LHTableau<T> &p_tableau,
+NashLcpStrategySolver<T>::OnBFS(const Game &p_game, const linalg::BFS<T> &cbfs,
                                 Solution &p_solution) const
 {
-  const Gambit::linalg::BFS<T> cbfs(p_tableau.GetColumnBFS());
   if (p_solution.Contains(cbfs)) {
     return SearchResult::PruneBranch;
   }
@@ -244,7 +285,7 @@ NashLcpStrategySolver<T>::AllLemke(const Game &p_game, int j, linalg::LHTableau<
   // On the initial depth=0 call, the CBFS we are at is the extraneous
   // solution.
   if (depth > 0) {
-    const auto result = OnBFS(p_game, B, p_solution);
+    const auto result = OnBFS(p_game, B.GetColumnBFS(), p_solution);
     if (result == SearchResult::PruneBranch) {
       return SearchResult::Continue;
     }
@@ -265,6 +306,230 @@ NashLcpStrategySolver<T>::AllLemke(const Game &p_game, int j, linalg::LHTableau<
   return SearchResult::Continue;
 }
 
+//
+// The parallel search visits the CBFSs in the same order as AllLemke, but the Lemke
+// paths it follows are computed ahead of it by a pool of threads.  The CBFSs found
+// form a graph, in which the edge from a CBFS for a label leads to the CBFS reached by
+// the path from it on which that label is dropped.  Once a CBFS is found, the threads
+// follow the paths from it for all its labels, whether or not the search goes on to
+// need them; the search waits for the edges it does need, or follows the path itself
+// if no thread has yet started on it.
+//
+template <class T> class NashLcpStrategySolver<T>::LemkeGraph {
+public:
+  LemkeGraph(const NashLcpStrategySolver<T> &p_solver, const linalg::LHTableau<T> &p_root)
+    : m_solver(p_solver), m_minCol(p_root.MinCol()), m_maxCol(p_root.MaxCol())
+  {
+    linalg::LHTableau<T> root(p_root);
+    auto bfs = root.GetColumnBFS();
+    AddNode(std::move(root), std::move(bfs), 0, 0);
+    const int numThreads = GetNumThreads(m_solver.m_numThreads);
+    m_workers.reserve(numThreads);
+    for (int t = 0; t < numThreads; t++) {
+      m_workers.emplace_back([this]() { Work(); });
+    }
+  }
+  LemkeGraph(const LemkeGraph &) = delete;
+  ~LemkeGraph()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+    }
+    m_stop.RequestCancel();
+    m_changed.notify_all();
+    for (auto &worker : m_workers) {
+      worker.join();
+    }
+  }
+  LemkeGraph &operator=(const LemkeGraph &) = delete;
+
+  int MinCol() const { return m_minCol; }
+  int MaxCol() const { return m_maxCol; }
+
+  /// Returns the basic solution at node p_node
+  const linalg::BFS<T> &GetBFS(size_t p_node) const
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    return m_nodes[p_node]->m_bfs;
+  }
+
+  /// Returns the node reached from node p_node by the path dropping label p_label
+  size_t GetEdge(size_t p_node, int p_label)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    Edge &edge = m_nodes[p_node]->m_edges[p_label - m_minCol];
+    if (edge.m_state == Edge::State::Pending) {
+      edge.m_state = Edge::State::Running;
+      lock.unlock();
+      Follow(p_node, p_label, m_solver.m_cancel);
+      lock.lock();
+    }
+    // The wait is bounded so that a cancellation request is noticed promptly
+    while (edge.m_state != Edge::State::Done) {
+      m_changed.wait_for(lock, std::chrono::milliseconds(10));
+      m_solver.m_cancel.Check();
+    }
+    if (edge.m_error) {
+      std::rethrow_exception(edge.m_error);
+    }
+    return edge.m_target;
+  }
+
+private:
+  struct Edge {
+    enum class State { Pending, Running, Done };
+    State m_state{State::Pending};
+    size_t m_target{0};
+    std::exception_ptr m_error;
+  };
+  struct Node {
+    linalg::LHTableau<T> m_tableau;
+    linalg::BFS<T> m_bfs;
+    int m_depth;
+    std::vector<Edge> m_edges;
+  };
+
+  const NashLcpStrategySolver<T> &m_solver;
+  int m_minCol, m_maxCol;
+  // Nodes are never removed, and their tableaux and solutions are not modified once
+  // added; edges and the containers below are guarded by m_mutex.
+  mutable std::mutex m_mutex;
+  std::condition_variable m_changed;
+  std::vector<std::unique_ptr<Node>> m_nodes;
+  std::unordered_map<std::set<int>, size_t, BasisHash> m_index;
+  std::vector<std::pair<size_t, int>> m_tasks;
+  bool m_stopping{false};
+  const CancelToken m_stop;
+  std::vector<std::thread> m_workers;
+
+  /// Adds a node for the CBFS p_bfs of p_tableau, reached at the given depth by
+  /// dropping p_label, and queues the paths from it.  Called with m_mutex held.
+  size_t AddNode(linalg::LHTableau<T> &&p_tableau, linalg::BFS<T> &&p_bfs, int p_label,
+                 int p_depth)
+  {
+    const size_t index = m_nodes.size();
+    m_index.emplace(p_bfs.Keys(), index);
+    m_nodes.push_back(std::make_unique<Node>(Node{std::move(p_tableau), std::move(p_bfs),
+                                                  p_depth,
+                                                  std::vector<Edge>(m_maxCol - m_minCol + 1)}));
+    // The search goes no further than the maximum depth, nor back along the path by
+    // which the node was reached, unless it is reached again by another path
+    if (m_solver.m_maxDepth == 0 || p_depth < m_solver.m_maxDepth) {
+      for (int label = m_maxCol; label >= m_minCol; label--) {
+        if (label != p_label) {
+          m_tasks.emplace_back(index, label);
+        }
+      }
+    }
+    return index;
+  }
+
+  /// Follows the path from node p_node dropping p_label, and records where it leads.
+  /// The edge must have been marked as running by the caller.
+  void Follow(size_t p_node, int p_label, const CancelToken &p_cancel)
+  {
+    const Node *node;
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      node = m_nodes[p_node].get();
+    }
+    std::optional<linalg::LHTableau<T>> tableau;
+    std::optional<linalg::BFS<T>> bfs;
+    std::exception_ptr error;
+    try {
+      tableau.emplace(node->m_tableau);
+      tableau->LemkePath(p_label, p_cancel);
+      bfs = tableau->GetColumnBFS();
+    }
+    catch (ComputationCanceledException &) {
+      if (m_stop.IsCanceled()) {
+        // The graph is being torn down, and the edge is no longer wanted
+        return;
+      }
+      throw;
+    }
+    catch (...) {
+      error = std::current_exception();
+    }
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    Edge &edge = m_nodes[p_node]->m_edges[p_label - m_minCol];
+    if (error) {
+      edge.m_error = error;
+    }
+    else if (auto known = m_index.find(bfs->Keys()); known != m_index.end()) {
+      edge.m_target = known->second;
+    }
+    else {
+      edge.m_target = AddNode(std::move(*tableau), std::move(*bfs), p_label,
+                              m_nodes[p_node]->m_depth + 1);
+    }
+    edge.m_state = Edge::State::Done;
+    m_changed.notify_all();
+  }
+
+  void Work()
+  {
+    while (true) {
+      size_t node;
+      int label;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+          m_changed.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+          if (m_stopping) {
+            return;
+          }
+          std::tie(node, label) = m_tasks.back();
+          m_tasks.pop_back();
+          Edge &edge = m_nodes[node]->m_edges[label - m_minCol];
+          if (edge.m_state == Edge::State::Pending) {
+            edge.m_state = Edge::State::Running;
+            break;
+          }
+        }
+      }
+      Follow(node, label, m_stop);
+    }
+  }
+};
+
+template <class T>
+typename NashLcpStrategySolver<T>::SearchResult
+NashLcpStrategySolver<T>::AllLemkeParallel(const Game &p_game, LemkeGraph &p_graph,
+                                           size_t p_node, int j, Solution &p_solution,
+                                           int depth) const
+{
+  m_cancel.Check();
+
+  if (m_maxDepth != 0 && depth > m_maxDepth) {
+    return SearchResult::Continue;
+  }
+
+  if (depth > 0) {
+    const auto result = OnBFS(p_game, p_graph.GetBFS(p_node), p_solution);
+    if (result == SearchResult::PruneBranch) {
+      return SearchResult::Continue;
+    }
+    if (result == SearchResult::LimitReached) {
+      return result;
+    }
+  }
+  if (m_maxDepth != 0 && depth == m_maxDepth) {
+    // The CBFSs reached from here would be beyond the maximum depth
+    return SearchResult::Continue;
+  }
+
+  for (int i = p_graph.MinCol(); i <= p_graph.MaxCol(); i++) {
+    if (i != j && AllLemkeParallel(p_game, p_graph, p_graph.GetEdge(p_node, i), i, p_solution,
+                                   depth + 1) == SearchResult::LimitReached) {
+      return SearchResult::LimitReached;
+    }
+  }
+  return SearchResult::Continue;
+}
+
 template <class T>
 std::list<MixedStrategyProfile<T>> NashLcpStrategySolver<T>::Solve(const Game &p_game) const
 {
@@ -283,12 +548,168 @@ std::list<MixedStrategyProfile<T>> NashLcpStrategySolver<T>::Solve(const Game &p
   const Vector<T> b2 = Make_b2<T>(p_game);
   linalg::LHTableau<T> B(A1, A2, b1, b2);
 
-  if (m_stopAfter != 1) {
+  if (m_stopAfter != 1 && GetNumThreads(m_numThreads) > 1) {
+    LemkeGraph graph(*this, B);
+    AllLemkeParallel(p_game, graph, 0, 0, solution, 0);
+  }
+  else if (m_stopAfter != 1) {
     AllLemke(p_game, 0, B, solution, 0);
   }
   else {
     B.LemkePath(1, m_cancel);
-    OnBFS(p_game, B, solution);
+    OnBFS(p_game, B.GetColumnBFS(), solution);
+  }
+  return solution.m_equilibria;
+}
+
+//
+// In the hybrid method, the search proceeds as in AllLemke, keeping at each node
+// both a floating-point tableau and an exact one at the same basis.  A path
+// is first followed in floating point.  If it leads to a basis not seen before,
+// the exact tableau is pivoted directly to that basis, and the basis is accepted
+// if it is a CBFS in exact arithmetic.  Otherwise, the path is followed again
+// in exact arithmetic from the parent's exact tableau, and the floating-point
+// tableau is moved to the basis this finds.  Should that fail, the search below
+// that node continues in exact arithmetic only.
+//
+template <class T>
+typename NashLcpStrategySolver<T>::PathResult
+NashLcpStrategySolver<T>::FollowApproximatePath(int p_label, linalg::LHTableau<double> &p_approx,
+                                                const linalg::LHTableau<T> &p_start,
+                                                std::optional<linalg::LHTableau<T>> &p_exact,
+                                                const Solution &p_solution) const
+{
+  const int maxPivots = MaxPivotsPerRow * (p_approx.MaxRow() - p_approx.MinRow() + 1);
+  try {
+    if (p_approx.LemkePath(p_label, m_cancel, maxPivots) == 0) {
+      return PathResult::Failed;
+    }
+    const auto labels = p_approx.GetBasisLabels();
+    std::set<int> keys;
+    std::copy_if(labels.begin(), labels.end(), std::inserter(keys, keys.end()),
+                 [](int label) { return label > 0; });
+    if (p_solution.Contains(keys)) {
+      return PathResult::Known;
+    }
+    p_exact.emplace(p_start);
+    if (p_exact->SetBasis(labels) && p_exact->IsCBFS()) {
+      return PathResult::Certified;
+    }
+  }
+  catch (ComputationCanceledException &) {
+    throw;
+  }
+  catch (std::exception &) {
+    // Numerical difficulties in floating point; fall through to exact pivoting
+  }
+  return PathResult::Failed;
+}
+
+template <class T>
+void NashLcpStrategySolver<T>::FollowHybridPath(int p_label,
+                                                std::optional<linalg::LHTableau<double>> &p_approx,
+                                                std::optional<linalg::LHTableau<T>> &p_exact) const
+{
+  p_exact->LemkePath(p_label, m_cancel);
+  if (!p_approx) {
+    return;
+  }
+  try {
+    if (p_approx->SetBasis(p_exact->GetBasisLabels()) && p_approx->IsCBFS()) {
+      return;
+    }
+  }
+  catch (ComputationCanceledException &) {
+    throw;
+  }
+  catch (std::exception &) {
+  }
+  p_approx.reset();
+}
+
+template <class T>
+typename NashLcpStrategySolver<T>::SearchResult
+NashLcpStrategySolver<T>::AllLemkeHybrid(const Game &p_game, int j,
+                                         const linalg::LHTableau<double> *p_approx,
+                                         linalg::LHTableau<T> &p_exact, Solution &p_solution,
+                                         int depth) const
+{
+  m_cancel.Check();
+
+  if (m_maxDepth != 0 && depth > m_maxDepth) {
+    return SearchResult::Continue;
+  }
+
+  if (depth > 0) {
+    const auto result = OnBFS(p_game, p_exact.GetColumnBFS(), p_solution);
+    if (result == SearchResult::PruneBranch) {
+      return SearchResult::Continue;
+    }
+    if (result == SearchResult::LimitReached) {
+      return result;
+    }
+  }
+
+  for (int i = p_exact.MinCol(); i <= p_exact.MaxCol(); i++) {
+    if (i == j) {
+      continue;
+    }
+    std::optional<linalg::LHTableau<double>> approx;
+    std::optional<linalg::LHTableau<T>> exact;
+    auto result = PathResult::Failed;
+    if (p_approx) {
+      approx.emplace(*p_approx);
+      result = FollowApproximatePath(i, *approx, p_exact, exact, p_solution);
+    }
+    if (result == PathResult::Known) {
+      continue;
+    }
+    if (result == PathResult::Failed) {
+      exact.emplace(p_exact);
+      if (p_approx) {
+        approx.emplace(*p_approx);
+      }
+      FollowHybridPath(i, approx, exact);
+    }
+    if (AllLemkeHybrid(p_game, i, (approx) ? &*approx : nullptr, *exact, p_solution,
+                       depth + 1) == SearchResult::LimitReached) {
+      return SearchResult::LimitReached;
+    }
+  }
+  return SearchResult::Continue;
+}
+
+template <>
+std::list<MixedStrategyProfile<Rational>>
+NashLcpStrategySolver<Rational>::SolveHybrid(const Game &p_game) const
+{
+  if (p_game->NumPlayers() != 2) {
+    throw UndefinedException("Method only valid for two-player games.");
+  }
+  if (!p_game->IsPerfectRecall()) {
+    throw UndefinedException(
+        "Computing equilibria of games with imperfect recall is not supported.");
+  }
+  Solution solution;
+
+  const linalg::LHTableau<double> approx(Make_A1<double>(p_game), Make_A2<double>(p_game),
+                                         Make_b1<double>(p_game), Make_b2<double>(p_game));
+  linalg::LHTableau<Rational> exact(Make_A1<Rational>(p_game), Make_A2<Rational>(p_game),
+                                    Make_b1<Rational>(p_game), Make_b2<Rational>(p_game));
+
+  if (m_stopAfter != 1) {
+    AllLemkeHybrid(p_game, 0, &approx, exact, solution, 0);
+  }
+  else {
+    std::optional<linalg::LHTableau<double>> approxPath(approx);
+    std::optional<linalg::LHTableau<Rational>> exactPath;
+    if (FollowApproximatePath(1, *approxPath, exact, exactPath, solution) !=
+        PathResult::Certified) {
+      exactPath.emplace(exact);
+      approxPath.reset();
+      FollowHybridPath(1, approxPath, exactPath);
+    }
+    OnBFS(p_game, exactPath->GetColumnBFS(), solution);
   }
   return solution.m_equilibria;
 }
@@ -296,15 +717,28 @@ std::list<MixedStrategyProfile<T>> NashLcpStrategySolver<T>::Solve(const Game &p
 template <class T>
 std::list<MixedStrategyProfile<T>>
 LcpStrategySolve(const Game &p_game, int p_stopAfter, int p_maxDepth,
-                 StrategyCallbackType<T> p_onEquilibrium, const CancelToken &p_cancel)
+                 StrategyCallbackType<T> p_onEquilibrium, const CancelToken &p_cancel,
+                 int p_numThreads)
 {
-  return NashLcpStrategySolver<T>(p_stopAfter, p_maxDepth, p_onEquilibrium, p_cancel)
+  return NashLcpStrategySolver<T>(p_stopAfter, p_maxDepth, p_onEquilibrium, p_cancel,
+                                  p_numThreads)
       .Solve(p_game);
 }
 
-template std::list<MixedStrategyProfile<double>>
-LcpStrategySolve(const Game &, int, int, StrategyCallbackType<double>, const CancelToken &);
+template std::list<MixedStrategyProfile<double>> LcpStrategySolve(const Game &, int, int,
+                                                                  StrategyCallbackType<double>,
+                                                                  const CancelToken &, int);
 template std::list<MixedStrategyProfile<Rational>>
-LcpStrategySolve(const Game &, int, int, StrategyCallbackType<Rational>, const CancelToken &);
+LcpStrategySolve(const Game &, int, int, StrategyCallbackType<Rational>, const CancelToken &,
+                 int);
+
+std::list<MixedStrategyProfile<Rational>>
+LcpStrategySolveHybrid(const Game &p_game, int p_stopAfter, int p_maxDepth,
+                       StrategyCallbackType<Rational> p_onEquilibrium,
+                       const CancelToken &p_cancel)
+{
+  return NashLcpStrategySolver<Rational>(p_stopAfter, p_maxDepth, p_onEquilibrium, p_cancel)
+      .SolveHybrid(p_game);
+}
 
 } // end namespace Gambit::Nash
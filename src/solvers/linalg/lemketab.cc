@@ -20,10 +20,68 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include <map>
+
 #include "lemketab.h"
 
 namespace Gambit::linalg {
 
+namespace {
+
+/// Supplies the columns of the inverse basis matrix consulted by the lexicographic
+/// tie-break of the exit rules.  Only the entries in the rows still tied are used.
+template <class T> class InverseColumns {
+public:
+  explicit InverseColumns(Tableau<T> &p_tableau) : m_tableau(p_tableau) {}
+
+  void Get(int c, const Array<int> &, Vector<T> &p_column)
+  {
+    m_tableau.SolveColumn(-c, p_column);
+  }
+
+private:
+  Tableau<T> &m_tableau;
+};
+
+/// With a factored basis, each column costs a full solve, and a tie among a few rows
+/// can persist over many columns.  Once as many columns have been solved as there are
+/// tied rows, those rows of the inverse are computed instead, one transposed solve
+/// each, and supply all the remaining columns.
+template <> class InverseColumns<double> {
+public:
+  explicit InverseColumns(Tableau<double> &p_tableau) : m_tableau(p_tableau) {}
+
+  void Get(int c, const Array<int> &p_rows, Vector<double> &p_column)
+  {
+    if (m_inverseRows.empty() && m_columnsSolved < p_rows.size()) {
+      m_columnsSolved++;
+      m_tableau.SolveColumn(-c, p_column);
+      return;
+    }
+    if (m_inverseRows.empty()) {
+      Vector<double> unit(m_tableau.MinRow(), m_tableau.MaxRow());
+      for (const int row : p_rows) {
+        unit = 0.0;
+        unit[row] = 1.0;
+        auto &inverseRow =
+            m_inverseRows.emplace(row, Vector<double>(m_tableau.MinRow(), m_tableau.MaxRow()))
+                .first->second;
+        m_tableau.SolveT(unit, inverseRow);
+      }
+    }
+    for (const int row : p_rows) {
+      p_column[row] = m_inverseRows.at(row)[c];
+    }
+  }
+
+private:
+  Tableau<double> &m_tableau;
+  size_t m_columnsSolved{0};
+  std::map<int, Vector<double>> m_inverseRows;
+};
+
+} // end anonymous namespace
+
 template <class T> int LemkeTableau<T>::SF_PivotIn(int inlabel)
 {
   const int outindex = SF_ExitIndex(inlabel);
@@ -63,12 +121,13 @@ template <class T> int LemkeTableau<T>::SF_ExitIndex(int inlabel)
   // a similar ratio, until only one candidate remains.
   c = this->MinRow() - 1;
   this->GetBasisVector(col);
+  InverseColumns<T> inverse(*this);
   while (BestSet.size() > 1) {
     if (c > this->MaxRow()) {
       throw BadExitIndex();
     }
     if (c >= this->MinRow()) {
-      this->SolveColumn(-c, col);
+      inverse.Get(c, BestSet, col);
     }
     // Initialize tempmax.
     tempmax = col[BestSet[1]] / incol[BestSet[1]];
@@ -127,12 +186,13 @@ template <class T> int LemkeTableau<T>::ExitIndex(int inlabel)
   // a similar ratio, until only one candidate remains.
   c = this->MinRow() - 1;
   this->GetBasisVector(col);
+  InverseColumns<T> inverse(*this);
   while (BestSet.size() > 1) {
     if (c > this->MaxRow()) {
       throw BadExitIndex();
     }
     if (c >= this->MinRow()) {
-      this->SolveColumn(-c, col);
+      inverse.Get(c, BestSet, col);
     }
     // Initialize tempmax.
     tempmax = col[BestSet[1]] / incol[BestSet[1]];
@@ -40,7 +40,7 @@ public:
     BadExitIndex() : std::runtime_error("Bad exit index in LemkeTableau") {}
     ~BadExitIndex() noexcept override = default;
   };
-  LemkeTableau(const Matrix<T> &A, const Vector<T> &b) : Tableau<T>(A, b) {}
+  LemkeTableau(const SparseMatrix<T> &A, const Vector<T> &b) : Tableau<T>(A, b) {}
   ~LemkeTableau() = default;
 
   int SF_PivotIn(int i);
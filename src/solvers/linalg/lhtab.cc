@@ -20,11 +20,48 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include <algorithm>
+
 #include "lhtab.h"
 #include "games.h"
 
 namespace Gambit::linalg {
 
+namespace {
+
+/// Brings each variable with a label in p_labels into the basis of p_tableau, in place of
+/// a variable whose label is not in p_labels.  Of the rows where this is possible, the
+/// one with the largest pivot element in magnitude is used.
+template <class T>
+bool PivotToBasis(LemkeTableau<T> &p_tableau, const std::set<int> &p_labels, Vector<T> &p_column)
+{
+  for (const int label : p_labels) {
+    if (!p_tableau.IsValidIndex(label) || p_tableau.IsMember(label)) {
+      continue;
+    }
+    p_tableau.SolveColumn(label, p_column);
+    int outrow = 0;
+    T largest{0};
+    for (int i = p_tableau.MinRow(); i <= p_tableau.MaxRow(); i++) {
+      if (p_labels.contains(p_tableau.GetLabel(i)) || p_tableau.IsEqZero(p_column[i])) {
+        continue;
+      }
+      const T magnitude = (p_column[i] < T{0}) ? -p_column[i] : p_column[i];
+      if (outrow == 0 || magnitude > largest) {
+        outrow = i;
+        largest = magnitude;
+      }
+    }
+    if (outrow == 0) {
+      return false;
+    }
+    p_tableau.Pivot(outrow, label);
+  }
+  return true;
+}
+
+} // end anonymous namespace
+
 //
 // General information
 //
@@ -68,6 +105,21 @@ template <class T> void LHTableau<T>::Pivot(int outrow, int inlabel)
   }
 }
 
+template <class T> std::set<int> LHTableau<T>::GetBasisLabels() const
+{
+  std::set<int> labels;
+  for (int i = MinRow(); i <= MaxRow(); i++) {
+    labels.insert(GetLabel(i));
+  }
+  return labels;
+}
+
+template <class T> bool LHTableau<T>::SetBasis(const std::set<int> &p_labels)
+{
+  return PivotToBasis(m_tableau1, p_labels, m_scratch1) &&
+         PivotToBasis(m_tableau2, p_labels, m_scratch2);
+}
+
 //
 // Miscellaneous functions
 //
@@ -91,6 +143,23 @@ template <class T> Gambit::linalg::BFS<T> LHTableau<T>::GetColumnBFS()
   return cbfs;
 }
 
+template <class T> bool LHTableau<T>::IsCBFS()
+{
+  for (int i = MinCol(); i <= MaxCol(); i++) {
+    if (IsMember(i) == IsMember(-i)) {
+      return false;
+    }
+  }
+  // The right-hand sides are negative, so at a feasible basis all basic variables
+  // take nonpositive values
+  m_tableau1.GetBasisVector(m_scratch1);
+  m_tableau2.GetBasisVector(m_scratch2);
+  return std::all_of(m_scratch1.begin(), m_scratch1.end(),
+                     [this](const T &x) { return m_tableau1.IsLeZero(x); }) &&
+         std::all_of(m_scratch2.begin(), m_scratch2.end(),
+                     [this](const T &x) { return m_tableau2.IsLeZero(x); });
+}
+
 template <class T> int LHTableau<T>::PivotIn(int inlabel)
 {
   const int outindex = ExitIndex(inlabel);
@@ -113,7 +182,8 @@ template <class T> int LHTableau<T>::ExitIndex(int inlabel)
   return 0;
 }
 
-template <class T> int LHTableau<T>::LemkePath(int dup, const CancelToken &p_cancel)
+template <class T>
+int LHTableau<T>::LemkePath(int dup, const CancelToken &p_cancel, int p_maxPivots)
 {
   int enter, exit;
   enter = dup;
@@ -121,9 +191,16 @@ template <class T> int LHTableau<T>::LemkePath(int dup, const CancelToken &p_can
     enter = -dup;
   }
   // Central loop - pivot until another CBFS is found
+  int pivots = 0;
   do {
     p_cancel.Check();
+    if (p_maxPivots > 0 && ++pivots > p_maxPivots) {
+      return 0;
+    }
     exit = PivotIn(enter);
+    if (exit == 0) {
+      return 0;
+    }
     enter = -exit;
   } while ((exit != dup) && (exit != -dup));
   return 1;
@@ -23,6 +23,8 @@
 #ifndef GAMBIT_SOLVERS_LINALG_LHTAB_H
 #define GAMBIT_SOLVERS_LINALG_LHTAB_H
 
+#include <set>
+
 #include "core/cancel.h"
 #include "lemketab.h"
 
@@ -65,12 +67,20 @@ public:
   //@{
   /// Perform apivot operation -- outgoing is row, incoming is column
   void Pivot(int outrow, int inlabel);
+  /// Returns the labels of the variables in the basis
+  std::set<int> GetBasisLabels() const;
+  /// Pivots to the basis made up of the variables with labels p_labels, as returned by
+  /// GetBasisLabels().  Returns false if the columns of these variables are linearly
+  /// dependent, in which case the tableau is left at some intermediate basis.
+  bool SetBasis(const std::set<int> &p_labels);
   //@}
 
   /// @name Miscellaneous functions
   //@{
   /// Basic feasible solution restricted to column-indexed (structural) variables
   BFS<T> GetColumnBFS();
+  /// Returns true if the basis is complementary and its basic solution is feasible
+  bool IsCBFS();
 
   int PivotIn(int i);
 
@@ -80,8 +90,10 @@ public:
   /// problem is degenerate.
   int ExitIndex(int i);
 
-  /// Follow a path of ACBFS's from one CBFS to another
-  int LemkePath(int dup, const CancelToken &p_cancel = CancelToken());
+  /// Follow a path of ACBFS's from one CBFS to another.  If p_maxPivots is positive,
+  /// the path is abandoned after that many pivots.  Returns 1 if a CBFS is reached,
+  /// and 0 if the path is abandoned or no variable can leave the basis.
+  int LemkePath(int dup, const CancelToken &p_cancel = CancelToken(), int p_maxPivots = 0);
   //@}
 
 private:
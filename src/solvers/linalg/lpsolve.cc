@@ -202,8 +202,8 @@ template <class T> void Solve(LPSolveState<T> &state, int phase)
 } // end anonymous namespace
 
 template <class T>
-LPSolveResult<T> SolveLP(const Matrix<T> &A, const Vector<T> &b, const Vector<T> &c, int nequals,
-                         const CancelToken &p_cancel)
+LPSolveResult<T> SolveLP(const SparseMatrix<T> &A, const Vector<T> &b, const Vector<T> &c,
+                         int nequals, const CancelToken &p_cancel)
 {
   const int nvars0 = static_cast<int>(c.size());
   const int neqns = static_cast<int>(b.size());
@@ -345,9 +345,9 @@ LPSolveResult<T> SolveLP(const Matrix<T> &A, const Vector<T> &b, const Vector<T>
 template struct LPSolveResult<double>;
 template struct LPSolveResult<Rational>;
 
-template LPSolveResult<double> SolveLP(const Matrix<double> &, const Vector<double> &,
+template LPSolveResult<double> SolveLP(const SparseMatrix<double> &, const Vector<double> &,
                                        const Vector<double> &, int, const CancelToken &);
-template LPSolveResult<Rational> SolveLP(const Matrix<Rational> &, const Vector<Rational> &,
+template LPSolveResult<Rational> SolveLP(const SparseMatrix<Rational> &, const Vector<Rational> &,
                                          const Vector<Rational> &, int, const CancelToken &);
 
 } // end namespace Gambit::linalg
@@ -47,8 +47,8 @@ template <class T> struct LPSolveResult {
 /// Solves the LP maximize c x subject to A x <= b, x >= 0, where the last
 /// `nequals` rows of A hold with equality.
 template <class T>
-LPSolveResult<T> SolveLP(const Matrix<T> &A, const Vector<T> &b, const Vector<T> &c, int nequals,
-                         const CancelToken &p_cancel = CancelToken());
+LPSolveResult<T> SolveLP(const SparseMatrix<T> &A, const Vector<T> &b, const Vector<T> &c,
+                         int nequals, const CancelToken &p_cancel = CancelToken());
 
 } // end namespace Gambit::linalg
 
@@ -25,14 +25,15 @@
 namespace Gambit::linalg {
 
 template <class T>
-LPTableau<T>::LPTableau(const Matrix<T> &A, const Vector<T> &b)
+LPTableau<T>::LPTableau(const SparseMatrix<T> &A, const Vector<T> &b)
   : Tableau<T>(A, b), m_dual(A.MinRow(), A.MaxRow()), m_unitCost(A.MinRow(), A.MaxRow()),
     m_cost(A.MinCol(), A.MaxCol())
 {
 }
 
 template <class T>
-LPTableau<T>::LPTableau(const Matrix<T> &A, const Array<int> &art, const Vector<T> &b)
+LPTableau<T>::LPTableau(const SparseMatrix<T> &A, const Array<int> &art,
+                        const Vector<T> &b)
   : Tableau<T>(A, art, b), m_dual(A.MinRow(), A.MaxRow()), m_unitCost(A.MinRow(), A.MaxRow()),
     m_cost(A.MinCol(), A.MaxCol() + art.size())
 {
@@ -31,8 +31,8 @@ namespace Gambit::linalg {
 
 template <class T> class LPTableau final : public Tableau<T> {
 public:
-  LPTableau(const Matrix<T> &A, const Vector<T> &b);
-  LPTableau(const Matrix<T> &A, const Array<int> &art, const Vector<T> &b);
+  LPTableau(const SparseMatrix<T> &A, const Vector<T> &b);
+  LPTableau(const SparseMatrix<T> &A, const Array<int> &art, const Vector<T> &b);
   LPTableau(const LPTableau<T> &) = default;
   ~LPTableau() = default;
 
@@ -20,12 +20,31 @@
 // Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 //
 
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+
 #include "games.h"
 #include "ludecomp.h"
 #include "tableau.h"
 
 namespace Gambit::linalg {
 
+namespace {
+
+/// The smallest magnitude a pivot may have, relative to the largest entry in its column
+constexpr double kPivotThreshold = 0.1;
+/// The number of further rows and columns examined once a candidate pivot is known
+constexpr int kPivotSearchLimit = 4;
+/// The number of eta matrices after which refactoring is forced, for numerical accuracy
+constexpr int kMaxUpdates = 100;
+/// The estimated cost of factoring the basis, per nonzero of the factors, relative to
+/// the cost of applying a nonzero of an eta matrix in a solve
+constexpr size_t kFactorCost = 8;
+
+} // end anonymous namespace
+
 //
 // Constructors and destructor
 //
@@ -34,17 +53,15 @@ template <class T>
 LUDecomposition<T>::LUDecomposition(const LUDecomposition<T> &a, Tableau<T> &t)
   : m_tableau(t), m_basis(t.GetBasis()), m_base(a.m_base), m_updateTail(a.m_updateTail),
     m_refactorInterval(a.m_refactorInterval),
-    m_iterationsSinceRefactor(a.m_iterationsSinceRefactor), m_totalOperations(a.m_totalOperations)
+    m_iterationsSinceRefactor(a.m_iterationsSinceRefactor), m_updateNonzeros(a.m_updateNonzeros)
 {
 }
 
 template <class T>
 LUDecomposition<T>::LUDecomposition(Tableau<T> &t, int rfac /* = 0 */)
   : m_tableau(t), m_basis(t.GetBasis()), m_base(std::make_shared<const BaseFactorization>()),
-    m_refactorInterval(rfac), m_iterationsSinceRefactor(0)
+    m_refactorInterval(rfac), m_iterationsSinceRefactor(0), m_updateNonzeros(0)
 {
-  auto m = m_basis.GetLast() - m_basis.GetFirst() + 1;
-  m_totalOperations = (m - 1) * m * (2 * m - 1) / 6;
 }
 
 //
@@ -62,14 +79,12 @@ template <class T> void LUDecomposition<T>::Copy(const LUDecomposition<T> &orig,
 
     m_refactorInterval = orig.m_refactorInterval;
     m_iterationsSinceRefactor = orig.m_iterationsSinceRefactor;
-    m_totalOperations = orig.m_totalOperations;
+    m_updateNonzeros = orig.m_updateNonzeros;
   }
 }
 
 template <class T> void LUDecomposition<T>::Update(int col, int matcol)
 {
-  const int m = m_basis.GetLast() - m_basis.GetFirst() + 1;
-
   m_iterationsSinceRefactor++;
   if ((m_refactorInterval > 0 && m_iterationsSinceRefactor >= m_refactorInterval) ||
       (m_refactorInterval == 0 && RefactorCheck())) {
@@ -82,10 +97,15 @@ template <class T> void LUDecomposition<T>::Update(int col, int matcol)
     if (scratch[col] == T{0}) {
       throw BadPivot();
     }
+    EtaMatrix eta{col, scratch[col], {}};
+    for (int i = scratch.front_index(); i <= scratch.back_index(); i++) {
+      if (i != col && scratch[i] != T{0}) {
+        eta.entries.emplace_back(i, scratch[i]);
+      }
+    }
+    m_updateNonzeros += eta.entries.size() + 1;
     m_updateTail =
-        std::make_shared<const EtaNode>(EtaNode{.eta = {col, scratch}, .prev = m_updateTail});
-
-    m_totalOperations += m_iterationsSinceRefactor * m + 2 * m * m;
+        std::make_shared<const EtaNode>(EtaNode{.eta = std::move(eta), .prev = m_updateTail});
   }
 }
 
@@ -95,8 +115,7 @@ template <class T> void LUDecomposition<T>::Refactor()
   m_updateTail = nullptr;
 
   m_iterationsSinceRefactor = 0;
-  const int m = m_basis.GetLast() - m_basis.GetFirst() + 1;
-  m_totalOperations = (m - 1) * m * (2 * m - 1) / 6;
+  m_updateNonzeros = 0;
 }
 
 template <class T> void LUDecomposition<T>::SolveT(const Vector<T> &c, Vector<T> &y) const
@@ -108,12 +127,14 @@ template <class T> void LUDecomposition<T>::SolveT(const Vector<T> &c, Vector<T>
     throw DimensionException();
   }
 
-  y = c;
-  if (!m_basis.IsIdent()) {
-    BTransE(y);
-    FTransU(y);
-    yLP_Trans(y);
+  if (m_basis.IsIdent()) {
+    y = c;
+    return;
   }
+  Vector<T> work(c);
+  BTransE(work);
+  FTransU(work, y);
+  BTransL(y);
 }
 
 template <class T> void LUDecomposition<T>::Solve(const Vector<T> &a, Vector<T> &d) const
@@ -125,12 +146,14 @@ template <class T> void LUDecomposition<T>::Solve(const Vector<T> &a, Vector<T>
     throw DimensionException();
   }
 
-  d = a;
-  if (!m_basis.IsIdent()) {
-    LPd_Trans(d);
-    BTransU(d);
-    FTransE(d);
+  if (m_basis.IsIdent()) {
+    d = a;
+    return;
   }
+  Vector<T> work(a);
+  FTransL(work);
+  BTransU(work, d);
+  FTransE(d);
 }
 
 //
@@ -139,92 +162,213 @@ template <class T> void LUDecomposition<T>::Solve(const Vector<T> &a, Vector<T>
 
 template <class T> typename LUDecomposition<T>::BaseFactorization LUDecomposition<T>::FactorBasis()
 {
-  BaseFactorization result;
+  const int first = m_basis.GetFirst();
+  const int m = m_basis.GetLast() - first + 1;
+
+  // The part of the basis not yet eliminated, by column with values and by row as a
+  // pattern only; indices are offsets from `first`.  Rows and columns are also kept
+  // in buckets by their number of nonzeros, to find sparse pivots quickly.
+  std::vector<std::map<int, T>> columns(m);
+  std::vector<std::set<int>> rows(m);
+  for (int j = 0; j < m; j++) {
+    for (const auto &entry : m_tableau.GetColumnEntries(m_basis.GetLabel(first + j))) {
+      if (entry.m_value != T{0}) {
+        columns[j][entry.m_row - first] = entry.m_value;
+        rows[entry.m_row - first].insert(j);
+      }
+    }
+  }
+  std::vector<std::set<int>> columnsByCount(m + 1), rowsByCount(m + 1);
+  for (int k = 0; k < m; k++) {
+    columnsByCount[columns[k].size()].insert(k);
+    rowsByCount[rows[k].size()].insert(k);
+  }
 
-  Matrix<T> B(m_basis.GetFirst(), m_basis.GetLast(), m_basis.GetFirst(), m_basis.GetLast());
+  auto columnMax = [&columns](int j) {
+    T colmax{0};
+    for (const auto &[i, value] : columns[j]) {
+      colmax = std::max(colmax, Gambit::abs(value));
+    }
+    return colmax;
+  };
 
-  Vector<T> scratch(m_basis.GetFirst(), m_basis.GetLast());
-  for (int i = m_basis.GetFirst(); i <= m_basis.GetLast(); i++) {
-    m_tableau.GetColumn(m_basis.GetLabel(i), scratch);
-    B.SetColumn(i, scratch);
-  }
+  BaseFactorization result;
+  result.steps.reserve(m);
+  for (int step = 0; step < m; step++) {
+    if (!columnsByCount[0].empty() || !rowsByCount[0].empty()) {
+      throw BadPivot();
+    }
 
-  for (int i = B.MinRow(); i <= B.MaxRow(); i++) {
-    T pivVal = Gambit::abs(B(i, i));
-    int piv = i;
-    for (int j = i + 1; j <= B.MaxRow(); j++) {
-      if (B(j, i) * B(j, i) > pivVal * pivVal) {
-        piv = j;
-        pivVal = B(j, i);
+    // Markowitz search: among entries large enough relative to their column, find
+    // one with the least product of (other entries in its row) and (in its column).
+    // Rows and columns are examined in increasing order of their number of entries,
+    // stopping when no unexamined entry could do better, or a few rows and columns
+    // after the first candidate.
+    int pivotRow = -1, pivotCol = -1;
+    size_t bestCost = std::numeric_limits<size_t>::max();
+    int searched = 0;
+    auto consider = [&](int i, int j, const T &value, const T &colmax) {
+      if (value == T{0} || Gambit::abs(value) < static_cast<T>(kPivotThreshold) * colmax) {
+        return;
+      }
+      const size_t cost = (rows[i].size() - 1) * (columns[j].size() - 1);
+      if (cost < bestCost) {
+        bestCost = cost;
+        pivotRow = i;
+        pivotCol = j;
+      }
+    };
+    for (size_t count = 1; count <= static_cast<size_t>(m); count++) {
+      for (const int j : columnsByCount[count]) {
+        const T colmax = columnMax(j);
+        for (const auto &[i, value] : columns[j]) {
+          consider(i, j, value, colmax);
+        }
+        if (pivotCol >= 0 && ++searched >= kPivotSearchLimit) {
+          break;
+        }
+      }
+      if (pivotCol >= 0 && (searched >= kPivotSearchLimit || bestCost <= (count - 1) * count)) {
+        break;
+      }
+      for (const int i : rowsByCount[count]) {
+        for (const int j : rows[i]) {
+          consider(i, j, columns[j].at(i), columnMax(j));
+        }
+        if (pivotCol >= 0 && ++searched >= kPivotSearchLimit) {
+          break;
+        }
+      }
+      if (pivotCol >= 0 && (searched >= kPivotSearchLimit || bestCost <= count * count)) {
+        break;
       }
     }
-    B.SwitchRows(i, piv);
+    if (pivotCol < 0) {
+      throw BadPivot();
+    }
 
-    scratch = T{0};
-    scratch[i] = T{1} / B(i, i);
-    for (int j = i + 1; j <= B.MaxRow(); j++) {
-      scratch[j] = -B(j, i) / B(i, i);
+    // Take the pivot row and column out of the active part, recording the multipliers
+    // for the pivot column and the remaining entries of the pivot row
+    const T pivot = columns[pivotCol].at(pivotRow);
+    SparseVector lower, upper;
+    columnsByCount[columns[pivotCol].size()].erase(pivotCol);
+    rowsByCount[rows[pivotRow].size()].erase(pivotRow);
+    for (const auto &[i, value] : columns[pivotCol]) {
+      if (i != pivotRow) {
+        lower.emplace_back(i, value / pivot);
+        rowsByCount[rows[i].size()].erase(i);
+        rows[i].erase(pivotCol);
+      }
     }
-    result.lowerFactors.push_back({piv, {i, scratch}});
-    GaussElem(B, i, i);
-  }
-  for (int j = B.MinCol(); j <= B.MaxCol(); j++) {
-    B.GetColumn(j, scratch);
-    result.upperEtas.push_back({j, scratch});
+    for (const int j : rows[pivotRow]) {
+      if (j != pivotCol) {
+        auto entry = columns[j].find(pivotRow);
+        upper.emplace_back(j, entry->second);
+        columnsByCount[columns[j].size()].erase(j);
+        columns[j].erase(entry);
+      }
+    }
+    columns[pivotCol].clear();
+    rows[pivotRow].clear();
+
+    // Eliminate the pivot column from the other rows, recording any fill-in
+    for (const auto &[j, u] : upper) {
+      auto &column = columns[j];
+      for (const auto &[i, l] : lower) {
+        auto [entry, inserted] = column.try_emplace(i, T{0});
+        entry->second -= l * u;
+        if (entry->second == T{0}) {
+          column.erase(entry);
+          if (!inserted) {
+            rows[i].erase(j);
+          }
+        }
+        else if (inserted) {
+          rows[i].insert(j);
+        }
+      }
+    }
+    for (auto &[i, l] : lower) {
+      rowsByCount[rows[i].size()].insert(i);
+      i += first;
+    }
+    for (auto &[j, u] : upper) {
+      columnsByCount[columns[j].size()].insert(j);
+      j += first;
+    }
+
+    result.nonzeros += 1 + lower.size() + upper.size();
+    result.steps.push_back(
+        {pivotRow + first, pivotCol + first, pivot, std::move(lower), std::move(upper)});
   }
   return result;
 }
 
-template <class T> void LUDecomposition<T>::GaussElem(Matrix<T> &B, int row, int col)
+template <class T> bool LUDecomposition<T>::RefactorCheck() const
 {
-  if (B(row, col) == T{0}) {
-    throw BadPivot();
-  }
-
-  for (int j = col + 1; j <= B.MaxCol(); j++) {
-    B(row, j) = B(row, j) / B(row, col);
-  }
+  // Each solve applies every eta matrix added since the last factorization, so the work
+  // spent on the eta file grows quadratically in the number of updates.  Refactoring
+  // pays for itself once that work exceeds the cost of a new factorization.
+  const size_t m = m_basis.GetLast() - m_basis.GetFirst() + 1;
+  return (m_iterationsSinceRefactor >= kMaxUpdates ||
+          m_iterationsSinceRefactor * m_updateNonzeros > kFactorCost * (m_base->nonzeros + m));
+}
 
-  for (int i = row + 1; i <= B.MaxRow(); i++) {
-    for (int j = col + 1; j <= B.MaxCol(); j++) {
-      B(i, j) = B(i, j) - (B(i, col) * B(row, j));
+template <class T> void LUDecomposition<T>::FTransL(Vector<T> &d) const
+{
+  for (const auto &step : m_base->steps) {
+    const T value = d[step.row];
+    if (value != T{0}) {
+      for (const auto &[i, multiplier] : step.lower) {
+        d[i] -= multiplier * value;
+      }
     }
   }
-
-  for (int i = row + 1; i <= B.MaxRow(); i++) {
-    B(i, col) = T{0};
-  }
-
-  B(row, col) = T{1};
 }
 
-template <class T> void LUDecomposition<T>::BTransE(Vector<T> &y) const
+template <class T> void LUDecomposition<T>::BTransU(const Vector<T> &w, Vector<T> &d) const
 {
-  for (auto node = m_updateTail; node; node = node->prev) {
-    VectorEtaSolve(node->eta, y);
-  }
+  // Back substitution; each step's row only involves columns pivoted after it.
+  // The empty factorization of the initial basis is the identity.
+  d = w;
+  std::for_each(m_base->steps.rbegin(), m_base->steps.rend(), [&](const PivotStep &step) {
+    T value = w[step.row];
+    for (const auto &[j, entry] : step.upper) {
+      value -= entry * d[j];
+    }
+    d[step.col] = value / step.pivot;
+  });
 }
 
-template <class T> void LUDecomposition<T>::FTransU(Vector<T> &y) const
+template <class T> void LUDecomposition<T>::FTransU(Vector<T> &w, Vector<T> &y) const
 {
-  for (const auto &eta : m_base->upperEtas) {
-    VectorEtaSolve(eta, y);
+  y = w;
+  for (const auto &step : m_base->steps) {
+    const T value = w[step.col] / step.pivot;
+    y[step.row] = value;
+    if (value != T{0}) {
+      for (const auto &[j, entry] : step.upper) {
+        w[j] -= value * entry;
+      }
+    }
   }
 }
 
-template <class T>
-void LUDecomposition<T>::VectorEtaSolve(const EtaMatrix &eta, Vector<T> &y) const
+template <class T> void LUDecomposition<T>::BTransL(Vector<T> &y) const
 {
-  Vector<T> v = y;
-  for (int i = v.front_index(); i <= v.back_index(); i++) {
-    if (i == eta.col) {
-      for (int j = v.front_index(); j <= v.back_index(); j++) {
-        if (j != eta.col) {
-          y[i] -= v[j] * eta.etadata[j];
-        }
-      }
-      y[i] /= eta.etadata[i];
+  std::for_each(m_base->steps.rbegin(), m_base->steps.rend(), [&](const PivotStep &step) {
+    T value{0};
+    for (const auto &[i, multiplier] : step.lower) {
+      value += y[i] * multiplier;
     }
+    y[step.row] -= value;
+  });
+}
+
+template <class T> void LUDecomposition<T>::BTransE(Vector<T> &y) const
+{
+  for (auto node = m_updateTail; node; node = node->prev) {
+    VectorEtaSolve(node->eta, y);
   }
 }
 
@@ -240,91 +384,27 @@ template <class T> void LUDecomposition<T>::FTransE(Vector<T> &y) const
   }
 }
 
-template <class T> void LUDecomposition<T>::BTransU(Vector<T> &y) const
-{
-  std::for_each(m_base->upperEtas.rbegin(), m_base->upperEtas.rend(),
-                [&](const EtaMatrix &m) { EtaVectorSolve(m, y); });
-}
-
-template <class T>
-void LUDecomposition<T>::EtaVectorSolve(const EtaMatrix &eta, Vector<T> &d) const
+template <class T> void LUDecomposition<T>::VectorEtaSolve(const EtaMatrix &eta, Vector<T> &y)
 {
-  if (eta.etadata[eta.col] == T{0}) {
-    throw BadPivot(); // or we would have a singular matrix
-  }
-  Vector<T> v = d;
-  T temp = v[eta.col] / eta.etadata[eta.col];
-
-  for (int i = v.front_index(); i <= v.back_index(); i++) {
-    if (i == eta.col) {
-      d[i] = temp;
-    }
-    else {
-      d[i] = v[i] - temp * eta.etadata[i];
-    }
-  }
-}
-
-template <class T> void LUDecomposition<T>::yLP_Trans(Vector<T> &y) const
-{
-  Vector<T> scratch(m_basis.GetFirst(), m_basis.GetLast());
-  for (int j = m_base->lowerFactors.size() - 1; j >= 0; j--) {
-    yLP_mult(y, j, scratch);
-    y = scratch;
+  T value = y[eta.col];
+  for (const auto &[i, entry] : eta.entries) {
+    value -= y[i] * entry;
   }
+  y[eta.col] = value / eta.pivot;
 }
 
-template <class T>
-void LUDecomposition<T>::yLP_mult(const Vector<T> &y, int j, Vector<T> &ans) const
+template <class T> void LUDecomposition<T>::EtaVectorSolve(const EtaMatrix &eta, Vector<T> &d)
 {
-  const int ell = j + y.front_index();
-
-  for (int i = y.front_index(); i <= y.back_index(); i++) {
-    if (i != m_base->lowerFactors[j].second.col) {
-      ans[i] = y[i];
-    }
-    else {
-      T temp{0};
-      for (int k = ans.front_index(); k <= ans.back_index(); k++) {
-        temp += y[k] * m_base->lowerFactors[j].second.etadata[k];
-      }
-      ans[i] = temp;
-    }
-  }
-  std::swap(ans[ell], ans[m_base->lowerFactors[j].first]);
-}
-
-template <class T> void LUDecomposition<T>::LPd_Trans(Vector<T> &d) const
-{
-  Vector<T> scratch(m_basis.GetFirst(), m_basis.GetLast());
-  for (size_t j = 0; j < m_base->lowerFactors.size(); j++) {
-    LPd_mult(d, j, scratch);
-    d = scratch;
+  if (eta.pivot == T{0}) {
+    throw BadPivot(); // or we would have a singular matrix
   }
-}
-
-template <class T> void LUDecomposition<T>::LPd_mult(Vector<T> &d, int j, Vector<T> &ans) const
-{
-  const int k = j + d.front_index();
-  std::swap(d[k], d[m_base->lowerFactors[j].first]);
-  for (int i = d.front_index(); i <= d.back_index(); i++) {
-    if (i == m_base->lowerFactors[j].second.col) {
-      ans[i] = d[i] * m_base->lowerFactors[j].second.etadata[i];
-    }
-    else {
-      ans[i] =
-          d[i] + d[m_base->lowerFactors[j].second.col] * m_base->lowerFactors[j].second.etadata[i];
+  const T value = d[eta.col] / eta.pivot;
+  d[eta.col] = value;
+  if (value != T{0}) {
+    for (const auto &[i, entry] : eta.entries) {
+      d[i] -= value * entry;
     }
   }
-  std::swap(d[m_base->lowerFactors[j].first], d[k]);
-}
-
-template <class T> bool LUDecomposition<T>::RefactorCheck()
-{
-  const int m = m_basis.GetLast() - m_basis.GetFirst() + 1;
-  const int i = m_iterationsSinceRefactor * (m_iterationsSinceRefactor * m + 2 * m * m);
-  const int k = m_totalOperations + m_iterationsSinceRefactor * m + 2 * m * m;
-  return i > k;
 }
 
 template class LUDecomposition<double>;
@@ -23,8 +23,9 @@
 #ifndef GAMBIT_SOLVERS_LINALG_LUDECOMP_H
 #define GAMBIT_SOLVERS_LINALG_LUDECOMP_H
 
-#include <list>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "core/core.h"
 
@@ -33,6 +34,13 @@ namespace Gambit::linalg {
 template <class T> class Tableau;
 class Basis;
 
+/// LU factorization of the basis matrix of a tableau, with product-form updates.
+///
+/// The basis is factored by Gaussian elimination over its nonzero entries only.  Pivots
+/// are chosen by the Markowitz criterion, which keeps fill-in low, subject to a
+/// threshold on their magnitude for numerical stability.  Each subsequent change of
+/// basis is recorded as a sparse eta matrix until the next refactoring, so memory and
+/// work both scale with the number of nonzeros rather than the square of the size.
 template <class T> class LUDecomposition {
 public:
   class BadPivot final : public std::runtime_error {
@@ -83,9 +91,15 @@ public:
   //@}
 
 private:
+  /// A sparse vector, as its nonzero entries (index, value)
+  using SparseVector = std::vector<std::pair<int, T>>;
+
+  /// The identity matrix with column `col` replaced; `pivot` is the entry on the
+  /// diagonal and `entries` are the nonzeros off it
   struct EtaMatrix {
     int col;
-    Vector<T> etadata;
+    T pivot;
+    SparseVector entries;
   };
 
   // Immutable node in a persistently-shared eta chain: forking is an O(1)
@@ -95,10 +109,20 @@ private:
     std::shared_ptr<const EtaNode> prev;
   };
 
+  /// One elimination step of the factorization, pivoting on (row, col) of the basis.
+  /// `lower` holds the multipliers eliminating the pivot column from the other rows,
+  /// and `upper` the other nonzeros remaining in the pivot row.
+  struct PivotStep {
+    int row, col;
+    T pivot;
+    SparseVector lower, upper;
+  };
+
   // FactorBasis()'s output: expensive to compute, shared across copies.
+  // An empty factorization stands for the initial (identity) basis.
   struct BaseFactorization {
-    std::list<EtaMatrix> upperEtas;
-    std::vector<std::pair<int, EtaMatrix>> lowerFactors;
+    std::vector<PivotStep> steps;
+    size_t nonzeros{0};
   };
 
   Tableau<T> &m_tableau;
@@ -109,27 +133,22 @@ private:
 
   int m_refactorInterval;
   int m_iterationsSinceRefactor;
-  int m_totalOperations;
+  // Total nonzeros in the eta matrices added since the last refactoring
+  size_t m_updateNonzeros;
 
   BaseFactorization FactorBasis();
 
-  void GaussElem(Matrix<T> &, int, int);
-
-  bool RefactorCheck();
+  bool RefactorCheck() const;
 
-  void BTransE(Vector<T> &) const;
+  void FTransL(Vector<T> &) const;
+  void BTransU(const Vector<T> &, Vector<T> &) const;
   void FTransE(Vector<T> &) const;
-  void BTransU(Vector<T> &) const;
-  void FTransU(Vector<T> &) const;
-  void LPd_Trans(Vector<T> &) const;
-  void yLP_Trans(Vector<T> &) const;
-
-  void VectorEtaSolve(const EtaMatrix &, Vector<T> &y) const;
-  void EtaVectorSolve(const EtaMatrix &, Vector<T> &d) const;
-
-  void yLP_mult(const Vector<T> &y, int j, Vector<T> &) const;
+  void BTransE(Vector<T> &) const;
+  void FTransU(Vector<T> &, Vector<T> &) const;
+  void BTransL(Vector<T> &) const;
 
-  void LPd_mult(Vector<T> &d, int j, Vector<T> &) const;
+  static void VectorEtaSolve(const EtaMatrix &, Vector<T> &y);
+  static void EtaVectorSolve(const EtaMatrix &, Vector<T> &d);
 
 }; // end of class LUDecomposition
 
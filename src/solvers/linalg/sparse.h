@@ -0,0 +1,167 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/solvers/linalg/sparse.h
+// Column-compressed sparse matrix used for tableau constraint data
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_SOLVERS_LINALG_SPARSE_H
+#define GAMBIT_SOLVERS_LINALG_SPARSE_H
+
+#include <algorithm>
+#include <vector>
+
+#include "core/core.h"
+
+namespace Gambit::linalg {
+
+/// A matrix which stores only its nonzero entries, column by column.
+///
+/// The row and column index ranges follow the conventions of Matrix, so a SparseMatrix
+/// can stand in for a Matrix wherever only column access is needed.  Memory is
+/// proportional to the number of nonzero entries plus the number of columns.
+template <class T> class SparseMatrix {
+public:
+  /// A nonzero entry in a column
+  struct Entry {
+    int m_row;
+    T m_value;
+  };
+
+  /// @name Lifecycle
+  //@{
+  /// Construct an all-zero matrix with the given index ranges
+  SparseMatrix(int p_minRow, int p_maxRow, int p_minCol, int p_maxCol)
+    : m_minRow(p_minRow), m_maxRow(p_maxRow), m_minCol(p_minCol),
+      m_columns(std::max(p_maxCol - p_minCol + 1, 0))
+  {
+  }
+  /// Construct from the nonzero entries of a dense matrix.  This conversion is
+  /// implicit, so that a dense matrix can be passed wherever a tableau expects its
+  /// constraint matrix.
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  SparseMatrix(const Matrix<T> &p_matrix)
+    : SparseMatrix(p_matrix.MinRow(), p_matrix.MaxRow(), p_matrix.MinCol(), p_matrix.MaxCol())
+  {
+    for (int j = MinCol(); j <= MaxCol(); j++) {
+      auto &column = m_columns[j - m_minCol];
+      for (int i = MinRow(); i <= MaxRow(); i++) {
+        if (p_matrix(i, j) != T{0}) {
+          column.push_back({i, p_matrix(i, j)});
+        }
+      }
+    }
+  }
+  SparseMatrix(const SparseMatrix<T> &) = default;
+  SparseMatrix(SparseMatrix<T> &&) noexcept = default;
+  ~SparseMatrix() = default;
+
+  SparseMatrix<T> &operator=(const SparseMatrix<T> &) = default;
+  SparseMatrix<T> &operator=(SparseMatrix<T> &&) noexcept = default;
+  //@}
+
+  /// @name Dimensions
+  //@{
+  int MinRow() const { return m_minRow; }
+  int MaxRow() const { return m_maxRow; }
+  int MinCol() const { return m_minCol; }
+  int MaxCol() const { return m_minCol + static_cast<int>(m_columns.size()) - 1; }
+  size_t NumRows() const { return std::max(m_maxRow - m_minRow + 1, 0); }
+  size_t NumColumns() const { return m_columns.size(); }
+  /// Returns the number of stored (nonzero) entries
+  size_t NumNonzeros() const
+  {
+    size_t count = 0;
+    for (const auto &column : m_columns) {
+      count += column.size();
+    }
+    return count;
+  }
+  //@}
+
+  /// @name Entry access
+  //@{
+  /// Returns the entry at (row, col), which is zero if not stored
+  T operator()(int p_row, int p_col) const
+  {
+    const auto &column = m_columns[p_col - m_minCol];
+    auto entry = std::find_if(column.begin(), column.end(),
+                              [p_row](const Entry &e) { return e.m_row == p_row; });
+    return (entry != column.end()) ? entry->m_value : T{0};
+  }
+  /// Sets the entry at (row, col).  Setting an entry to zero removes it.
+  void Set(int p_row, int p_col, const T &p_value)
+  {
+    if (p_row < m_minRow || p_row > m_maxRow || p_col < MinCol() || p_col > MaxCol()) {
+      throw std::out_of_range("Index out of range in SparseMatrix::Set");
+    }
+    auto &column = m_columns[p_col - m_minCol];
+    auto entry = std::find_if(column.begin(), column.end(),
+                              [p_row](const Entry &e) { return e.m_row == p_row; });
+    if (p_value == T{0}) {
+      if (entry != column.end()) {
+        column.erase(entry);
+      }
+    }
+    else if (entry != column.end()) {
+      entry->m_value = p_value;
+    }
+    else {
+      column.push_back({p_row, p_value});
+    }
+  }
+  /// Returns the nonzero entries of column col, in no particular order of rows
+  const std::vector<Entry> &GetColumnEntries(int p_col) const
+  {
+    return m_columns[p_col - m_minCol];
+  }
+  /// Scatters column col into the dense vector p_column
+  template <class V> void GetColumn(int p_col, V &p_column) const
+  {
+    if (p_col < MinCol() || p_col > MaxCol()) {
+      throw std::out_of_range("Index out of range in SparseMatrix::GetColumn");
+    }
+    std::fill(p_column.begin(), p_column.end(), T{0});
+    for (const auto &entry : m_columns[p_col - m_minCol]) {
+      p_column[entry.m_row] = entry.m_value;
+    }
+  }
+  /// Replaces column col by the nonzero entries of the dense vector p_column
+  template <class V> void SetColumn(int p_col, const V &p_column)
+  {
+    if (p_col < MinCol() || p_col > MaxCol()) {
+      throw std::out_of_range("Index out of range in SparseMatrix::SetColumn");
+    }
+    auto &column = m_columns[p_col - m_minCol];
+    column.clear();
+    for (int i = m_minRow; i <= m_maxRow; i++) {
+      if (p_column[i] != T{0}) {
+        column.push_back({i, p_column[i]});
+      }
+    }
+  }
+  //@}
+
+private:
+  int m_minRow, m_maxRow, m_minCol;
+  std::vector<std::vector<Entry>> m_columns;
+};
+
+} // end namespace Gambit::linalg
+
+#endif // GAMBIT_SOLVERS_LINALG_SPARSE_H
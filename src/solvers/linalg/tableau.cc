@@ -32,14 +32,15 @@ namespace Gambit::linalg {
 // Constructors and destructor
 //
 
-Tableau<double>::Tableau(const Matrix<double> &A, const Vector<double> &b)
+Tableau<double>::Tableau(const SparseMatrix<double> &A, const Vector<double> &b)
   : TableauBase<double>(A, b), m_luDecomposition(*this),
     m_scratchColumn(b.front_index(), b.back_index())
 {
   Solve(b, m_solution);
 }
 
-Tableau<double>::Tableau(const Matrix<double> &A, const Array<int> &art, const Vector<double> &b)
+Tableau<double>::Tableau(const SparseMatrix<double> &A, const Array<int> &art,
+                         const Vector<double> &b)
   : TableauBase<double>(A, art, b), m_luDecomposition(*this),
     m_scratchColumn(b.front_index(), b.back_index())
 {
@@ -170,12 +171,12 @@ BFS<double> Tableau<double>::GetColumnBFS() const
 //                   Tableau<Rational> method definitions
 // ---------------------------------------------------------------------------
 
-Integer find_lcd(const Matrix<Rational> &mat)
+Integer find_lcd(const SparseMatrix<Rational> &mat)
 {
   Integer lcd(1);
-  for (int i = mat.MinRow(); i <= mat.MaxRow(); i++) {
-    for (int j = mat.MinCol(); j <= mat.MaxCol(); j++) {
-      lcd = lcm(mat(i, j).denominator(), lcd);
+  for (int j = mat.MinCol(); j <= mat.MaxCol(); j++) {
+    for (const auto &entry : mat.GetColumnEntries(j)) {
+      lcd = lcm(entry.m_value.denominator(), lcd);
     }
   }
   return lcd;
@@ -194,7 +195,7 @@ Integer find_lcd(const Vector<Rational> &vec)
 // Constructors and destructor
 //
 
-Tableau<Rational>::Tableau(const Matrix<Rational> &A, const Vector<Rational> &b)
+Tableau<Rational>::Tableau(const SparseMatrix<Rational> &A, const Vector<Rational> &b)
   : TableauBase<Rational>(A, b), m_tableauData(A.MinRow(), A.MaxRow(), A.MinCol(), A.MaxCol()),
     m_scaledRHS(b.front_index(), b.back_index()), m_pivotDenominator(1),
     m_scratchColumn(b.front_index(), b.back_index()), m_nonbasicLabels(A.MinCol(), A.MaxCol())
@@ -215,13 +216,13 @@ Tableau<Rational>::Tableau(const Matrix<Rational> &A, const Vector<Rational> &b)
     }
     m_scaledRHS[i] = x.numerator();
   }
-  for (int i = MinRow(); i <= MaxRow(); i++) {
-    for (int j = MinCol(); j <= MaxCol(); j++) {
-      const Rational x = A(i, j) * static_cast<Rational>(m_totalDenominator);
+  for (int j = MinCol(); j <= MaxCol(); j++) {
+    for (const auto &entry : A.GetColumnEntries(j)) {
+      const Rational x = entry.m_value * static_cast<Rational>(m_totalDenominator);
       if (x.denominator() != 1) {
         throw BadDenom();
       }
-      m_tableauData(i, j) = x.numerator();
+      m_tableauData(entry.m_row, j) = x.numerator();
     }
   }
   for (int i = b.front_index(); i <= b.back_index(); i++) {
@@ -229,7 +230,7 @@ Tableau<Rational>::Tableau(const Matrix<Rational> &A, const Vector<Rational> &b)
   }
 }
 
-Tableau<Rational>::Tableau(const Matrix<Rational> &A, const Array<int> &art,
+Tableau<Rational>::Tableau(const SparseMatrix<Rational> &A, const Array<int> &art,
                            const Vector<Rational> &b)
   : TableauBase<Rational>(A, art, b),
     m_tableauData(A.MinRow(), A.MaxRow(), A.MinCol(), A.MaxCol() + art.size()),
@@ -253,18 +254,18 @@ Tableau<Rational>::Tableau(const Matrix<Rational> &A, const Array<int> &art,
     }
     m_scaledRHS[i] = x.numerator();
   }
-  for (int i = MinRow(); i <= MaxRow(); i++) {
-    for (int j = MinCol(); j <= A.MaxCol(); j++) {
-      const Rational x = A(i, j) * static_cast<Rational>(m_totalDenominator);
+  for (int j = MinCol(); j <= A.MaxCol(); j++) {
+    for (const auto &entry : A.GetColumnEntries(j)) {
+      const Rational x = entry.m_value * static_cast<Rational>(m_totalDenominator);
       if (x.denominator() != 1) {
         throw BadDenom();
       }
-      m_tableauData(i, j) = x.numerator();
-    }
-    for (int j = A.MaxCol() + 1; j <= MaxCol(); j++) {
-      m_tableauData(m_artificialColumns[j], j) = m_totalDenominator;
+      m_tableauData(entry.m_row, j) = x.numerator();
     }
   }
+  for (int j = A.MaxCol() + 1; j <= MaxCol(); j++) {
+    m_tableauData(m_artificialColumns[j], j) = m_totalDenominator;
+  }
   for (int i = b.front_index(); i <= b.back_index(); i++) {
     m_solution[i] = static_cast<Rational>(m_scaledRHS[i]);
   }
@@ -420,7 +421,7 @@ void Tableau<Rational>::GetColumn(int col, Vector<Rational> &out) const
 void Tableau<Rational>::Refactor()
 {
   Vector<Rational> mytmpcol(m_scratchColumn);
-  m_totalDenominator = lcm(find_lcd(m_A), find_lcd(m_b));
+  m_totalDenominator = lcm(find_lcd(*m_A), find_lcd(m_b));
   if (m_totalDenominator <= 0) {
     throw BadDenom();
   }
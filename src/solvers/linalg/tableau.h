@@ -23,10 +23,12 @@
 #ifndef GAMBIT_SOLVERS_LINALG_TABLEAU_H
 #define GAMBIT_SOLVERS_LINALG_TABLEAU_H
 
+#include <memory>
 #include <set>
 
 #include "core/core.h"
 #include "ludecomp.h"
+#include "sparse.h"
 
 namespace Gambit::linalg {
 
@@ -183,14 +185,16 @@ public:
 
 template <class T> class TableauBase {
 public:
-  TableauBase(const Matrix<T> &A, const Vector<T> &b)
-    : m_A(A), m_b(b), m_basis(A.MinRow(), A.MaxRow(), A.MinCol(), A.MaxCol()),
+  TableauBase(const SparseMatrix<T> &A, const Vector<T> &b)
+    : m_A(std::make_shared<const SparseMatrix<T>>(A)), m_b(b),
+      m_basis(A.MinRow(), A.MaxRow(), A.MinCol(), A.MaxCol()),
       m_solution(A.MinRow(), A.MaxRow()), m_feasibilityTolerance(ComputeEpsilon(5)),
       m_zeroTolerance(ComputeEpsilon()), m_artificialColumns(A.MaxCol() + 1, A.MaxCol())
   {
   }
-  TableauBase(const Matrix<T> &A, const Array<int> &art, const Vector<T> &b)
-    : m_A(A), m_b(b), m_basis(A.MinRow(), A.MaxRow(), A.MinCol(), A.MaxCol() + art.size()),
+  TableauBase(const SparseMatrix<T> &A, const Array<int> &art, const Vector<T> &b)
+    : m_A(std::make_shared<const SparseMatrix<T>>(A)), m_b(b),
+      m_basis(A.MinRow(), A.MaxRow(), A.MinCol(), A.MaxCol() + art.size()),
       m_solution(A.MinRow(), A.MaxRow()), m_feasibilityTolerance(ComputeEpsilon(5)),
       m_zeroTolerance(ComputeEpsilon()),
       m_artificialColumns(A.MaxCol() + 1, A.MaxCol() + art.size())
@@ -206,8 +210,8 @@ public:
 
   /// @name Information
   //@{
-  int MinRow() const { return m_A.MinRow(); }
-  int MaxRow() const { return m_A.MaxRow(); }
+  int MinRow() const { return m_A->MinRow(); }
+  int MaxRow() const { return m_A->MaxRow(); }
   int MinCol() const { return m_basis.MinCol(); }
   int MaxCol() const { return m_basis.MaxCol(); }
 
@@ -230,13 +234,27 @@ public:
       ret[m_artificialColumns[col]] = T{1};
     }
     else if (m_basis.IsRegColumn(col)) {
-      m_A.GetColumn(col, ret);
+      m_A->GetColumn(col, ret);
     }
     else if (m_basis.IsSlackColumn(col)) {
       ret = T{0};
       ret[-col] = T{1};
     }
   }
+  /// Returns the nonzero entries of the column, without scattering it into a dense vector
+  std::vector<typename SparseMatrix<T>::Entry> GetColumnEntries(int col) const
+  {
+    if (IsArtifColumn(col)) {
+      return {{m_artificialColumns[col], T{1}}};
+    }
+    if (m_basis.IsRegColumn(col)) {
+      return m_A->GetColumnEntries(col);
+    }
+    if (m_basis.IsSlackColumn(col)) {
+      return {{-col, T{1}}};
+    }
+    return {};
+  }
   //@}
 
   /// @name Miscellaneous functions
@@ -256,7 +274,9 @@ public:
   //@}
 
 protected:
-  Matrix<T> m_A;
+  /// The constraint matrix, of which only the nonzero entries are stored.  It is never
+  /// modified, so copies of a tableau share it.
+  std::shared_ptr<const SparseMatrix<T>> m_A;
   Vector<T> m_b;
   Basis m_basis;
   /// Current solution vector
@@ -285,8 +305,8 @@ template <> class Tableau<double> : public TableauBase<double> {
 public:
   /// @name Constructors and destructor
   //@{
-  Tableau(const Matrix<double> &A, const Vector<double> &b);
-  Tableau(const Matrix<double> &A, const Array<int> &art, const Vector<double> &b);
+  Tableau(const SparseMatrix<double> &A, const Vector<double> &b);
+  Tableau(const SparseMatrix<double> &A, const Array<int> &art, const Vector<double> &b);
   Tableau(const Tableau<double> &);
   ~Tableau() = default;
 
@@ -333,8 +353,8 @@ public:
     ~BadDenom() noexcept override = default;
   };
 
-  Tableau(const Matrix<Rational> &A, const Vector<Rational> &b);
-  Tableau(const Matrix<Rational> &A, const Array<int> &art, const Vector<Rational> &b);
+  Tableau(const SparseMatrix<Rational> &A, const Vector<Rational> &b);
+  Tableau(const SparseMatrix<Rational> &A, const Array<int> &art, const Vector<Rational> &b);
   Tableau(const Tableau<Rational> &) = default;
   ~Tableau() = default;
 
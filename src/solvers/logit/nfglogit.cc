@@ -261,20 +261,11 @@ void EquationSystem::GetJacobian(const Vector<double> &p_point, Matrix<double> &
   PointToProfile(m_profile, p_point);
   const double lambda = p_point.back();
   Vector<double> column(p_point.size());
-  m_strategyDerivs = 0.0;
   int row = 1;
-  for (const auto &strategy1 : m_game->GetStrategies()) {
-    m_strategyValues[row] = m_profile.GetPayoff(strategy1);
-    int col = 1;
-    for (const auto &strategy2 : m_game->GetStrategies()) {
-      if (strategy1->GetPlayer() != strategy2->GetPlayer()) {
-        m_strategyDerivs(row, col) =
-            m_profile.GetPayoffDeriv(strategy1->GetPlayer()->GetNumber(), strategy1, strategy2);
-      }
-      col++;
-    }
-    row++;
+  for (const auto &strategy : m_game->GetStrategies()) {
+    m_strategyValues[row++] = m_profile.GetPayoff(strategy);
   }
+  m_profile.GetPayoffDerivs(m_strategyDerivs);
   for (size_t i = 1; i <= m_equations.size(); i++) {
     m_equations[i - 1]->Gradient(m_profile, m_strategyValues, m_strategyDerivs, lambda, column);
     p_jac.SetColumn(i, column);
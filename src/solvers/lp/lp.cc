@@ -85,10 +85,9 @@ struct TableauIndexMap {
   }
 };
 
-template <class T> Matrix<T> ConstructMatrix(const TableauIndexMap &p_indexMap)
+template <class T> linalg::SparseMatrix<T> ConstructMatrix(const TableauIndexMap &p_indexMap)
 {
-  Matrix<T> A(1, p_indexMap.rows, 1, p_indexMap.cols);
-  A = T{0};
+  linalg::SparseMatrix<T> A(1, p_indexMap.rows, 1, p_indexMap.cols);
 
   const Game &game = p_indexMap.game;
   const GamePlayer player1 = game->GetPlayer(1);
@@ -103,13 +102,12 @@ template <class T> Matrix<T> ConstructMatrix(const TableauIndexMap &p_indexMap)
   // weighted by chance's probability of that pair actually being realised
   // (which need not be 1 -- see PureSequenceProfile::GetRealizationProbability).
   // Player 2's payoff is not separately represented, since the game is
-  // constant-sum.
-  for (auto profile : game->GetSequenceContingencies()) {
-    const GameSequence &seq1 = profile.GetSequence(player1);
-    const GameSequence &seq2 = profile.GetSequence(player2);
-    const Rational prob = profile.GetRealizationProbability();
-    const Rational pay1 = profile.GetPayoff(player1) - payoffShift * prob;
-    A(p_indexMap.rowIndex.at(seq1), p_indexMap.colIndex.at(seq2)) = static_cast<T>(pay1);
+  // constant-sum.  Only the pairs realised at some terminal node have
+  // nonzero entries.
+  for (const auto &entry : GetSequenceFormEntries(game)) {
+    const Rational pay1 = entry.m_payoffs[0] - payoffShift * entry.m_probability;
+    A.Set(p_indexMap.rowIndex.at(entry.m_sequences[0]),
+          p_indexMap.colIndex.at(entry.m_sequences[1]), static_cast<T>(pay1));
   }
 
   // Constraint block for player 1: the sum-to-one relation between the
@@ -120,9 +118,9 @@ template <class T> Matrix<T> ConstructMatrix(const TableauIndexMap &p_indexMap)
     const int col = p_indexMap.colInfosetIndex.at(infoset);
     const auto children = infoset->GetSequences();
     const int arrivalRow = p_indexMap.rowIndex.at(children.front()->GetParent());
-    A(arrivalRow, col) = T{1};
+    A.Set(arrivalRow, col, T{1});
     for (const auto &child : children) {
-      A(p_indexMap.rowIndex.at(child), col) = T{-1};
+      A.Set(p_indexMap.rowIndex.at(child), col, T{-1});
     }
   }
 
@@ -132,9 +130,9 @@ template <class T> Matrix<T> ConstructMatrix(const TableauIndexMap &p_indexMap)
     const int row = p_indexMap.rowInfosetIndex.at(infoset);
     const auto children = infoset->GetSequences();
     const int arrivalCol = p_indexMap.colIndex.at(children.front()->GetParent());
-    A(row, arrivalCol) = T{-1};
+    A.Set(row, arrivalCol, T{-1});
     for (const auto &child : children) {
-      A(row, p_indexMap.colIndex.at(child)) = T{1};
+      A.Set(row, p_indexMap.colIndex.at(child), T{1});
     }
   }
 
@@ -144,8 +142,8 @@ template <class T> Matrix<T> ConstructMatrix(const TableauIndexMap &p_indexMap)
   // sequence at 1.
   const GameSequence root1 = player1->GetSequences().front();
   const GameSequence root2 = player2->GetSequences().front();
-  A(p_indexMap.rowIndex.at(root1), p_indexMap.colAnchor) = T{-1};
-  A(p_indexMap.rowAnchor, p_indexMap.colIndex.at(root2)) = T{1};
+  A.Set(p_indexMap.rowIndex.at(root1), p_indexMap.colAnchor, T{-1});
+  A.Set(p_indexMap.rowAnchor, p_indexMap.colIndex.at(root2), T{1});
 
   return A;
 }
@@ -196,7 +194,7 @@ MixedBehaviorProfile<T> GetBehavior(const Array<T> &p_primal, const Array<T> &p_
 // replace this function.
 //
 template <class T>
-void SolveLP(const Matrix<T> &A, const Vector<T> &b, const Vector<T> &c, int nequals,
+void SolveLP(const linalg::SparseMatrix<T> &A, const Vector<T> &b, const Vector<T> &c, int nequals,
              Array<T> &p_primal, Array<T> &p_dual, const CancelToken &p_cancel = CancelToken())
 {
   const auto result = linalg::SolveLP(A, b, c, nequals, p_cancel);
@@ -227,7 +225,7 @@ std::list<MixedBehaviorProfile<T>> LpBehaviorSolve(const Game &p_game,
   }
 
   const TableauIndexMap indexMap(p_game);
-  const Matrix<T> A = ConstructMatrix<T>(indexMap);
+  const linalg::SparseMatrix<T> A = ConstructMatrix<T>(indexMap);
   const Vector<T> b = ConstructB<T>(indexMap);
   const Vector<T> c = ConstructC<T>(indexMap);
 
@@ -293,7 +291,7 @@ std::list<MixedStrategyProfile<T>> LpStrategySolve(const Game &p_game,
   c[m + 1] = static_cast<T>(1);
 
   Array<T> primal(A.NumColumns()), dual(A.NumRows());
-  SolveLP(A, b, c, 1, primal, dual, p_cancel);
+  SolveLP(linalg::SparseMatrix<T>(A), b, c, 1, primal, dual, p_cancel);
 
   MixedStrategyProfile<T> eqm(p_game->NewMixedStrategyProfile(static_cast<T>(0)));
   for (int j = 1; j <= m; j++) {
@@ -0,0 +1,204 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/solvers/multistart.h
+// Running a method from many starting points
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#ifndef GAMBIT_SOLVERS_MULTISTART_H
+#define GAMBIT_SOLVERS_MULTISTART_H
+
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "core/parallel.h"
+#include "solvers/nash.h"
+
+namespace Gambit::Nash {
+
+/// @brief An index of profiles, for recognising those which are within a tolerance of
+///        one already seen.
+///
+/// Two profiles are taken to be the same if no probability in them differs by more than
+/// the tolerance.  Profiles are keyed by a weighted sum of their probabilities, with
+/// weights in (0, 1); the keys of profiles which are the same then differ by at most the
+/// tolerance times the total weight, so only the profiles with keys in that range need be
+/// compared.
+template <class Profile> class DistinctProfiles {
+public:
+  explicit DistinctProfiles(double p_tolerance) : m_tolerance(p_tolerance) {}
+
+  /// Adds p_profile to the index if it is not the same as one already in it, and returns
+  /// whether it was added
+  bool Insert(const Profile &p_profile)
+  {
+    const Vector<double> &probs = GetProbabilities(p_profile);
+    double key = 0.0, weight = 0.0;
+    for (size_t i = 1; i <= probs.size(); ++i) {
+      key += Weight(i) * probs[i];
+      weight += Weight(i);
+    }
+    const double radius = m_tolerance * weight;
+    for (auto entry = m_keys.lower_bound(key - radius);
+         entry != m_keys.end() && entry->first <= key + radius; ++entry) {
+      const Vector<double> &other = m_profiles[entry->second];
+      bool same = true;
+      for (size_t i = 1; same && i <= probs.size(); ++i) {
+        same = std::abs(probs[i] - other[i]) <= m_tolerance;
+      }
+      if (same) {
+        return false;
+      }
+    }
+    m_keys.emplace(key, m_profiles.size());
+    m_profiles.push_back(probs);
+    return true;
+  }
+
+private:
+  double m_tolerance;
+  std::vector<Vector<double>> m_profiles;
+  std::multimap<double, size_t> m_keys;
+
+  /// The weights are spread over (0, 1) by the golden ratio, so that profiles which
+  /// differ only by exchanging probabilities are nonetheless unlikely to share a key
+  static double Weight(size_t p_index)
+  {
+    const double frac = std::fmod(static_cast<double>(p_index) * 0.6180339887498949, 1.0);
+    return (frac > 0.0) ? frac : 0.5;
+  }
+  static const Vector<double> &GetProbabilities(const MixedStrategyProfile<double> &p_profile)
+  {
+    return p_profile.GetProbVector();
+  }
+  static const Vector<double> &GetProbabilities(const MixedBehaviorProfile<double> &p_profile)
+  {
+    return p_profile;
+  }
+};
+
+/// @brief Runs a method from each of a list of starting points, on up to p_numThreads
+///        threads, and returns the equilibria found.
+///
+/// p_solve(start, token) runs the method from the starting point start, which is an
+/// element of p_starts, and returns the equilibria found from it; it is called
+/// concurrently for distinct starting points, and should stop promptly once token is
+/// canceled.  Each run works on copies of the profiles it is given, so the runs share
+/// nothing other than the game, which they do not modify.
+///
+/// Results are taken in the order of p_starts, whichever run finishes first, so the
+/// equilibria returned do not depend on the number of threads.  For each starting point
+/// in turn, p_onSolved(start) is called, and then p_onEquilibrium for each of the
+/// equilibria found from it which are reported.  If p_tolerance is given, an equilibrium
+/// is only reported if it differs by more than p_tolerance in some probability from each
+/// equilibrium reported before it.  The callbacks are called in the calling thread.
+///
+/// If p_timeLimit is positive, the runs still in progress once that many seconds have
+/// passed are abandoned, and the equilibria reported to that point are returned.
+template <class Profile, class Solve, class OnSolved, class OnEquilibrium>
+std::list<Profile> MultiStartSolve(const std::vector<Profile> &p_starts, Solve p_solve,
+                                   OnSolved p_onSolved, OnEquilibrium p_onEquilibrium,
+                                   std::optional<double> p_tolerance = std::nullopt,
+                                   double p_timeLimit = 0.0,
+                                   const CancelToken &p_cancel = CancelToken(),
+                                   int p_numThreads = 1)
+{
+  std::list<Profile> equilibria;
+  std::optional<DistinctProfiles<Profile>> distinct;
+  if (p_tolerance) {
+    distinct.emplace(*p_tolerance);
+  }
+
+  // With a time limit, the runs are given a token which is canceled either when the
+  // limit is reached or when p_cancel is
+  const CancelToken budget;
+  std::mutex mutex;
+  std::condition_variable finished;
+  bool done = false;
+  std::thread watcher;
+  if (p_timeLimit > 0.0) {
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::duration<double>(p_timeLimit);
+    watcher = std::thread([&, deadline]() {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (!done && !p_cancel.IsCanceled() && std::chrono::steady_clock::now() < deadline) {
+        finished.wait_for(lock, std::chrono::milliseconds(10));
+      }
+      if (!done) {
+        budget.RequestCancel();
+      }
+    });
+  }
+  auto stopWatcher = [&]() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      done = true;
+    }
+    finished.notify_all();
+    if (watcher.joinable()) {
+      watcher.join();
+    }
+  };
+
+  size_t next = 0;
+  try {
+    ParallelPipeline(
+        GetNumThreads(p_numThreads), (p_timeLimit > 0.0) ? budget : p_cancel,
+        [&]() -> std::optional<size_t> {
+          if (next < p_starts.size()) {
+            return next++;
+          }
+          return std::nullopt;
+        },
+        [&](size_t p_index, const CancelToken &p_token) {
+          return p_solve(p_starts[p_index], p_token);
+        },
+        [&](size_t p_index, std::list<Profile> p_found) {
+          p_onSolved(p_starts[p_index]);
+          for (const auto &profile : p_found) {
+            if (!distinct || distinct->Insert(profile)) {
+              p_onEquilibrium(profile);
+              equilibria.push_back(profile);
+            }
+          }
+          return true;
+        });
+  }
+  catch (ComputationCanceledException &) {
+    stopWatcher();
+    if (p_cancel.IsCanceled() || !budget.IsCanceled()) {
+      throw;
+    }
+    return equilibria;
+  }
+  catch (...) {
+    stopWatcher();
+    throw;
+  }
+  stopWatcher();
+  return equilibria;
+}
+
+} // namespace Gambit::Nash
+
+#endif // GAMBIT_SOLVERS_MULTISTART_H
@@ -26,6 +26,7 @@
 #include <numeric>
 
 #include "nashsupport.h"
+#include "games/stratdom.h"
 
 using namespace Gambit;
 
@@ -96,12 +97,18 @@ StrategySupportProfile RestrictedGame(const Game &game, const GamePlayer &player
   return profile;
 }
 
-bool AnyDominatedStrategies(const Game &game, std::map<GamePlayer, StrategySupport> &domains)
+/// Returns true if any strategy in the domain of a player is strictly dominated by some
+/// strategy of the player, against the domains of the other players.
+bool AnyDominatedStrategies(const Game &game, std::map<GamePlayer, StrategySupport> &domains,
+                            std::map<GamePlayer, StrategyDominance> &dominance)
 {
   for (auto [player, strategies] : domains) {
-    auto support_profile = RestrictedGame(game, player, domains);
+    auto &playerDominance = dominance.at(player);
+    playerDominance.Restrict(RestrictedGame(game, player, domains));
+    auto candidates = player->GetStrategies();
+    const StrategySupport allStrategies(candidates.begin(), candidates.end());
     for (auto strategy : strategies) {
-      if (support_profile.IsDominated(strategy, true)) {
+      if (playerDominance.IsDominated(strategy, allStrategies, true)) {
         return true;
       }
     }
@@ -207,6 +214,12 @@ public:
       m_xIt(m_xRange.begin()), m_xEnd(m_xRange.end()), m_sizeProfileRange(m_numActions),
       m_spIt(m_sizeProfileRange.end()), m_spEnd(m_sizeProfileRange.end()), m_current(p_game)
   {
+    // The payoffs for the dominance tests are tabulated once, against all profiles;
+    // each test is then restricted to the domains current at the time.
+    const StrategySupportProfile full(p_game);
+    for (const auto &player : p_game->GetPlayers()) {
+      m_dominance.emplace(player, StrategyDominance(full, player));
+    }
   }
 
   std::optional<StrategySupportProfile> Next()
@@ -251,7 +264,7 @@ private:
         continue;
       }
       m_currentSupports[frame.player] = *frame.cur;
-      if (AnyDominatedStrategies(m_game, m_currentSupports)) {
+      if (AnyDominatedStrategies(m_game, m_currentSupports, m_dominance)) {
         ++frame.cur;
         continue;
       }
@@ -334,6 +347,7 @@ private:
   std::vector<StrategySubsets> m_domains;
   std::vector<Frame> m_stack;
   std::map<GamePlayer, StrategySupport> m_currentSupports;
+  std::map<GamePlayer, StrategyDominance> m_dominance;
   StrategySupportProfile m_current;
 };
 
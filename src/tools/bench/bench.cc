@@ -0,0 +1,724 @@
+//
+// This file is part of Gambit
+// Copyright (c) 1994-2026, The Gambit Project (https://www.gambit-project.org)
+//
+// FILE: src/tools/bench/bench.cc
+// Time equilibrium computation methods over collections of games
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+//
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <getopt.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "gambit.h"
+
+using namespace Gambit;
+using namespace Gambit::Nash;
+
+namespace {
+
+//=========================================================================
+//                          Methods to be timed
+//=========================================================================
+
+struct MethodOptions {
+  bool useFloat{false};
+  int numThreads{1};
+};
+
+/// The results of one run of a method which are reported alongside its timing
+struct RunStatistics {
+  size_t equilibria{0};
+  /// The number of steps (path points, iterations, supports) reported through the
+  /// method's event callback, for methods which report progress
+  std::optional<size_t> steps;
+};
+
+using Method =
+    std::function<RunStatistics(const Game &, const MethodOptions &, const CancelToken &)>;
+
+/// Returns an event callback which counts the events of type Event
+template <class Event, class Variant> auto CountEvents(std::optional<size_t> &p_count)
+{
+  p_count = 0;
+  return [&p_count](const Variant &p_event) {
+    if (std::holds_alternative<Event>(p_event)) {
+      ++*p_count;
+    }
+  };
+}
+
+template <class T> RunStatistics RunEnumMixed(const Game &p_game, const MethodOptions &p_options,
+                                              const CancelToken &p_cancel)
+{
+  return {EnumMixedStrategySolve<T>(p_game, NullStrategyCallback<T>, p_cancel,
+                                    p_options.numThreads)
+              .size()};
+}
+
+template <class T> RunStatistics RunLcp(const Game &p_game, const CancelToken &p_cancel)
+{
+  if (p_game->IsTree()) {
+    return {LcpBehaviorSolve<T>(p_game, NullBehaviorCallback<T>, p_cancel).size()};
+  }
+  return {LcpStrategySolve<T>(p_game, 0, 0, NullStrategyCallback<T>, p_cancel).size()};
+}
+
+template <class T> RunStatistics RunLp(const Game &p_game, const CancelToken &p_cancel)
+{
+  if (p_game->IsTree()) {
+    return {LpBehaviorSolve<T>(p_game, NullBehaviorCallback<T>, p_cancel).size()};
+  }
+  return {LpStrategySolve<T>(p_game, NullStrategyCallback<T>, p_cancel).size()};
+}
+
+/// The methods, keyed by name.  Each is run with the same default parameters as the
+/// corresponding command-line tool, from a deterministic starting point where one is
+/// needed, so that runs are reproducible.
+const std::map<std::string, Method> &GetMethods()
+{
+  static const std::map<std::string, Method> methods = {
+      {"enummixed",
+       [](const Game &p_game, const MethodOptions &p_options, const CancelToken &p_cancel) {
+         return (p_options.useFloat) ? RunEnumMixed<double>(p_game, p_options, p_cancel)
+                                     : RunEnumMixed<Rational>(p_game, p_options, p_cancel);
+       }},
+      {"enumpoly",
+       [](const Game &p_game, const MethodOptions &p_options, const CancelToken &p_cancel) {
+         RunStatistics stats;
+         if (p_game->IsTree()) {
+           using Event = EnumPolyEvent<BehaviorSupportProfile>;
+           stats.equilibria =
+               EnumPolyBehaviorSolve(
+                   p_game, 0, 1.0e-8, kDefaultEnumPolyMaxRectangles,
+                   NullBehaviorCallback<double>,
+                   CountEvents<EnumPolyCandidateSupportEvent<BehaviorSupportProfile>, Event>(
+                       stats.steps),
+                   p_cancel, p_options.numThreads)
+                   .size();
+         }
+         else {
+           using Event = EnumPolyEvent<StrategySupportProfile>;
+           stats.equilibria =
+               EnumPolyStrategySolve(
+                   p_game, 0, 1.0e-8, kDefaultEnumPolyMaxRectangles,
+                   NullStrategyCallback<double>,
+                   CountEvents<EnumPolyCandidateSupportEvent<StrategySupportProfile>, Event>(
+                       stats.steps),
+                   p_cancel, p_options.numThreads)
+                   .size();
+         }
+         return stats;
+       }},
+      {"enumpure",
+       [](const Game &p_game, const MethodOptions &p_options, const CancelToken &p_cancel) {
+         return RunStatistics{EnumPureStrategySolve(p_game, NullStrategyCallback<Rational>,
+                                                    p_cancel, p_options.numThreads)
+                                  .size()};
+       }},
+      {"gnm",
+       [](const Game &p_game, const MethodOptions &, const CancelToken &p_cancel) {
+         RunStatistics stats;
+         stats.equilibria =
+             GNMStrategySolve(p_game, GNM_LAMBDA_END_DEFAULT, GNM_STEPS_DEFAULT,
+                              GNM_LOCAL_NEWTON_INTERVAL_DEFAULT, GNM_LOCAL_NEWTON_MAXITS_DEFAULT,
+                              NullStrategyCallback<double>,
+                              CountEvents<GNMStepEvent, GNMEvent>(stats.steps), p_cancel)
+                 .size();
+         return stats;
+       }},
+      {"ipa",
+       [](const Game &p_game, const MethodOptions &, const CancelToken &p_cancel) {
+         RunStatistics stats;
+         stats.equilibria =
+             IPAStrategySolve(p_game, NullStrategyCallback<double>,
+                              CountEvents<IPAStepEvent, IPAEvent>(stats.steps), p_cancel)
+                 .size();
+         return stats;
+       }},
+      {"lcp",
+       [](const Game &p_game, const MethodOptions &p_options, const CancelToken &p_cancel) {
+         return (p_options.useFloat) ? RunLcp<double>(p_game, p_cancel)
+                                     : RunLcp<Rational>(p_game, p_cancel);
+       }},
+      {"liap",
+       [](const Game &p_game, const MethodOptions &, const CancelToken &p_cancel) {
+         return RunStatistics{
+             LiapStrategySolve(p_game->NewMixedStrategyProfile(0.0), 1.0e-4, 1000,
+                               NullStrategyCallback<double>,
+                               NullLiapEventCallback<MixedStrategyProfile<double>>, p_cancel)
+                 .size()};
+       }},
+      // The points along the traced branch are returned; the last approximates an equilibrium
+      {"logit",
+       [](const Game &p_game, const MethodOptions &p_options, const CancelToken &p_cancel) {
+         RunStatistics stats;
+         if (p_game->IsTree()) {
+           using QRE = LogitQREMixedBehaviorProfile;
+           stats.equilibria =
+               !LogitBehaviorSolve(
+                    QRE(p_game), 1.0e-8, 1.0, 0.03, 1.1, NullBehaviorCallback<double>,
+                    CountEvents<LogitPathEvent<QRE>, LogitEvent<QRE>>(stats.steps), p_cancel)
+                    .empty();
+         }
+         else {
+           using QRE = LogitQREMixedStrategyProfile;
+           stats.equilibria =
+               !LogitStrategySolve(
+                    QRE(p_game), 1.0e-8, 1.0, 0.03, 1.1, NullStrategyCallback<double>,
+                    CountEvents<LogitPathEvent<QRE>, LogitEvent<QRE>>(stats.steps), p_cancel)
+                    .empty();
+         }
+         return stats;
+       }},
+      {"lp",
+       [](const Game &p_game, const MethodOptions &p_options, const CancelToken &p_cancel) {
+         return (p_options.useFloat) ? RunLp<double>(p_game, p_cancel)
+                                     : RunLp<Rational>(p_game, p_cancel);
+       }},
+      {"simpdiv",
+       [](const Game &p_game, const MethodOptions &, const CancelToken &p_cancel) {
+         RunStatistics stats;
+         stats.equilibria =
+             SimpdivStrategySolve(SimpdivDefaultStart(p_game), Rational(1, 10000000), 2, 0,
+                                  NullStrategyCallback<Rational>,
+                                  CountEvents<SimpdivRefinementEvent, SimpdivEvent>(stats.steps),
+                                  p_cancel)
+                 .size();
+         return stats;
+       }}};
+  return methods;
+}
+
+//=========================================================================
+//                       Timing and resource usage
+//=========================================================================
+
+/// Requests cancellation of a computation if it has not finished within a time limit
+class Watchdog {
+public:
+  Watchdog(const CancelToken &p_cancel, double p_seconds)
+  {
+    if (p_seconds > 0.0) {
+      m_thread = std::thread([this, p_cancel, p_seconds]() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_finished.wait_for(lock, std::chrono::duration<double>(p_seconds),
+                                 [this]() { return m_done; })) {
+          p_cancel.RequestCancel();
+        }
+      });
+    }
+  }
+  Watchdog(const Watchdog &) = delete;
+  ~Watchdog()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_done = true;
+    }
+    m_finished.notify_all();
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+  Watchdog &operator=(const Watchdog &) = delete;
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_finished;
+  bool m_done{false};
+  std::thread m_thread;
+};
+
+struct RunResult {
+  std::string status{"ok"}, message;
+  double seconds{0.0};
+  RunStatistics statistics;
+  /// Peak resident set size in kilobytes, where this can be measured
+  std::optional<long> peakMemory;
+};
+
+/// Runs p_method once on p_game, requesting cancellation once p_timeLimit seconds
+/// (if positive) have passed
+RunResult RunMethod(const Method &p_method, const Game &p_game, const MethodOptions &p_options,
+                    double p_timeLimit)
+{
+  RunResult result;
+  const CancelToken cancel;
+  const auto start = std::chrono::steady_clock::now();
+  try {
+    const Watchdog watchdog(cancel, p_timeLimit);
+    result.statistics = p_method(p_game, p_options, cancel);
+  }
+  catch (ComputationCanceledException &) {
+    result.status = "timeout";
+  }
+  catch (UndefinedException &e) {
+    result.status = "skipped";
+    result.message = e.what();
+  }
+  catch (std::exception &e) {
+    result.status = "error";
+    result.message = e.what();
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  result.seconds = elapsed.count();
+  return result;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+/// Runs p_method once on p_game in a child process.  This measures the peak memory
+/// use of each run separately, and allows runs which do not respond promptly to
+/// cancellation to be stopped.
+RunResult RunMethodInChild(const Method &p_method, const Game &p_game,
+                           const MethodOptions &p_options, double p_timeLimit)
+{
+  int fds[2];
+  if (pipe(fds) != 0) {
+    throw std::runtime_error("Unable to create pipe to child process");
+  }
+  std::cout.flush();
+  const pid_t pid = fork();
+  if (pid < 0) {
+    throw std::runtime_error("Unable to create child process");
+  }
+  if (pid == 0) {
+    close(fds[0]);
+    const auto result = RunMethod(p_method, p_game, p_options, p_timeLimit);
+    auto message = result.message;
+    std::replace(message.begin(), message.end(), '\n', ' ');
+    std::ostringstream report;
+    report << std::setprecision(17) << result.status << '\n'
+           << message << '\n'
+           << result.seconds << '\n'
+           << result.statistics.equilibria << '\n'
+           << (result.statistics.steps ? std::to_string(*result.statistics.steps) : "-")
+           << '\n';
+    const std::string text = report.str();
+    for (size_t written = 0; written < text.size();) {
+      const auto count = write(fds[1], text.data() + written, text.size() - written);
+      if (count <= 0) {
+        break;
+      }
+      written += count;
+    }
+    _exit(0);
+  }
+
+  close(fds[1]);
+  // Allow a second beyond the time limit for the method to respond to cancellation
+  const auto start = std::chrono::steady_clock::now();
+  const auto deadline = start + std::chrono::duration<double>(p_timeLimit + 1.0);
+  std::string text;
+  bool killed = false;
+  for (;;) {
+    int timeout = -1;
+    if (p_timeLimit > 0.0) {
+      const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline - std::chrono::steady_clock::now());
+      timeout = std::max(0, static_cast<int>(remaining.count()));
+    }
+    pollfd fd{fds[0], POLLIN, 0};
+    if (poll(&fd, 1, timeout) == 0) {
+      kill(pid, SIGKILL);
+      killed = true;
+      break;
+    }
+    char buffer[256];
+    const auto count = read(fds[0], buffer, sizeof(buffer));
+    if (count <= 0) {
+      break;
+    }
+    text.append(buffer, count);
+  }
+  close(fds[0]);
+  int status = 0;
+  rusage usage{};
+  wait4(pid, &status, 0, &usage);
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  RunResult result;
+#if defined(__APPLE__)
+  result.peakMemory = usage.ru_maxrss / 1024;
+#else
+  result.peakMemory = usage.ru_maxrss;
+#endif
+  std::istringstream report(text);
+  std::string steps;
+  if (!killed && std::getline(report, result.status) && std::getline(report, result.message) &&
+      report >> result.seconds >> result.statistics.equilibria >> steps) {
+    if (steps != "-") {
+      result.statistics.steps = std::stoul(steps);
+    }
+    return result;
+  }
+  result.seconds = elapsed.count();
+  if (killed) {
+    result.status = "timeout";
+  }
+  else {
+    result.status = "error";
+    result.message = (WIFSIGNALED(status))
+                         ? "Terminated by signal " + std::to_string(WTERMSIG(status))
+                         : "Terminated without reporting a result";
+  }
+  return result;
+}
+#endif // defined(__unix__) || defined(__APPLE__)
+
+/// Times p_repeats runs of p_method on p_game, reporting the fastest
+RunResult TimeMethod(const Method &p_method, const Game &p_game, const MethodOptions &p_options,
+                     double p_timeLimit, int p_repeats)
+{
+  RunResult best;
+  std::optional<long> peakMemory;
+  for (int repeat = 0; repeat < p_repeats; repeat++) {
+#if defined(__unix__) || defined(__APPLE__)
+    const auto result = RunMethodInChild(p_method, p_game, p_options, p_timeLimit);
+#else
+    const auto result = RunMethod(p_method, p_game, p_options, p_timeLimit);
+#endif
+    if (result.peakMemory) {
+      peakMemory = std::max(peakMemory.value_or(0), *result.peakMemory);
+    }
+    if (repeat == 0 || result.status != "ok" || result.seconds < best.seconds) {
+      best = result;
+    }
+    if (result.status != "ok") {
+      break;
+    }
+  }
+  best.peakMemory = peakMemory;
+  return best;
+}
+
+//=========================================================================
+//                             Game collections
+//=========================================================================
+
+/// Builds a game in strategic form with the given numbers of strategies, with
+/// payoffs drawn uniformly from the integers 0 to 99
+Game NewRandomTable(const std::vector<int> &p_dim, std::default_random_engine &p_engine)
+{
+  const Game game = NewTable(p_dim);
+  std::uniform_int_distribution<int> payoff(0, 99);
+  for (const auto &profile : StrategyContingencies(game)) {
+    for (const auto &player : game->GetPlayers()) {
+      profile->GetOutcome()->SetPayoff(player, Number(Rational(payoff(p_engine))));
+    }
+  }
+  return game;
+}
+
+/// Parses a shape such as "10x10x5" into the numbers of strategies per player
+std::vector<int> ParseShape(const std::string &p_shape)
+{
+  std::vector<int> dim;
+  std::istringstream stream(p_shape);
+  std::string token;
+  while (std::getline(stream, token, 'x')) {
+    const int strategies = std::atoi(token.c_str());
+    if (strategies < 1) {
+      throw std::runtime_error("Invalid game shape '" + p_shape + "'");
+    }
+    dim.push_back(strategies);
+  }
+  if (dim.empty()) {
+    throw std::runtime_error("Invalid game shape '" + p_shape + "'");
+  }
+  return dim;
+}
+
+/// Returns the game files at p_path, searching directories recursively, as pairs of
+/// the path to the file and the name under which to report it.  Files in a directory
+/// are named relative to the directory's parent, so that names do not depend on where
+/// the collection is located.
+std::vector<std::pair<std::filesystem::path, std::string>>
+FindGameFiles(const std::filesystem::path &p_path)
+{
+  static const std::set<std::string> extensions = {".efg", ".nfg", ".agg", ".bagg"};
+  std::vector<std::pair<std::filesystem::path, std::string>> files;
+  if (!std::filesystem::is_directory(p_path)) {
+    files.emplace_back(p_path, p_path.generic_string());
+    return files;
+  }
+  const auto root = p_path.lexically_normal().parent_path();
+  for (const auto &entry : std::filesystem::recursive_directory_iterator(p_path)) {
+    if (entry.is_regular_file() && extensions.contains(entry.path().extension().string())) {
+      files.emplace_back(entry.path(),
+                         entry.path().lexically_normal().lexically_relative(root).generic_string());
+    }
+  }
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+//=========================================================================
+//                              JSON output
+//=========================================================================
+
+std::string QuoteJSON(const std::string &p_text)
+{
+  std::ostringstream quoted;
+  quoted << '"';
+  for (const char c : p_text) {
+    switch (c) {
+    case '"':
+      quoted << "\\\"";
+      break;
+    case '\\':
+      quoted << "\\\\";
+      break;
+    case '\n':
+      quoted << "\\n";
+      break;
+    case '\t':
+      quoted << "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20) {
+        quoted << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+               << std::dec << std::setfill(' ');
+      }
+      else {
+        quoted << c;
+      }
+    }
+  }
+  quoted << '"';
+  return quoted.str();
+}
+
+class ResultWriter {
+public:
+  explicit ResultWriter(std::ostream &p_stream) : m_stream(p_stream) {}
+
+  void Write(const std::string &p_game, const std::string &p_method, const RunResult &p_result)
+  {
+    m_stream << ((m_count++ == 0) ? "\n" : ",\n");
+    m_stream << "    {\"game\": " << QuoteJSON(p_game) << ", \"method\": " << QuoteJSON(p_method)
+             << ", \"status\": " << QuoteJSON(p_result.status);
+    if (!p_result.message.empty()) {
+      m_stream << ", \"message\": " << QuoteJSON(p_result.message);
+    }
+    m_stream << ", \"wall_time\": " << std::setprecision(6) << p_result.seconds
+             << ", \"equilibria\": " << p_result.statistics.equilibria << ", \"steps\": ";
+    if (p_result.statistics.steps) {
+      m_stream << *p_result.statistics.steps;
+    }
+    else {
+      m_stream << "null";
+    }
+    m_stream << ", \"peak_memory_kb\": ";
+    if (p_result.peakMemory) {
+      m_stream << *p_result.peakMemory;
+    }
+    else {
+      m_stream << "null";
+    }
+    m_stream << "}" << std::flush;
+  }
+
+private:
+  std::ostream &m_stream;
+  size_t m_count{0};
+};
+
+} // end anonymous namespace
+
+void PrintBanner(std::ostream &p_stream)
+{
+  p_stream << "Time equilibrium computation methods over collections of games\n";
+  p_stream << "Gambit version " VERSION ", Copyright (C) 1994-2026, The Gambit Project\n";
+  p_stream << "This is free software, distributed under the GNU GPL\n\n";
+}
+
+void PrintHelp(char *progname)
+{
+  PrintBanner(std::cerr);
+  std::cerr << "Usage: " << progname << " [OPTIONS] [path ...]\n";
+  std::cerr << "Times each method on each game in the given files and directories\n";
+  std::cerr << "(searched recursively), and on any randomly-generated games requested,\n";
+  std::cerr << "writing the results to standard output in JSON format.\n\n";
+
+  std::cerr << "Options:\n";
+  std::cerr << "  -m METHODS       comma-separated list of methods to time (default is all:\n";
+  std::cerr << "                   enummixed, enumpoly, enumpure, gnm, ipa, lcp, liap,\n";
+  std::cerr << "                   logit, lp, simpdiv)\n";
+  std::cerr << "  -g SHAPE         also time games with random payoffs and the given numbers\n";
+  std::cerr << "                   of strategies per player, e.g. 10x10 (may be repeated)\n";
+  std::cerr << "  -n COUNT         number of random games of each shape (default is 1)\n";
+  std::cerr << "  -R SEED          seed for generating random games (default is 1)\n";
+  std::cerr << "  -d               use floating-point arithmetic for methods which\n";
+  std::cerr << "                   otherwise compute in rational arithmetic\n";
+  std::cerr << "  -t SECONDS       abandon each run after SECONDS seconds\n";
+  std::cerr << "                   (default is 10; 0 for no limit)\n";
+  std::cerr << "  -r REPEATS       run each method REPEATS times on each game, reporting\n";
+  std::cerr << "                   the fastest (default is 1)\n";
+  std::cerr << "  -j THREADS       number of threads for methods which can use several\n";
+  std::cerr << "                   (default is 1; 0 for all available threads)\n";
+  std::cerr << "  -h, --help       print this help message\n";
+  std::cerr << "  -q               quiet mode (suppresses banner)\n";
+  std::cerr << "  -v, --version    print version information\n";
+  exit(0);
+}
+
+int main(int argc, char *argv[])
+{
+  opterr = 0;
+  bool quiet = false;
+  MethodOptions options;
+  double timeLimit = 10.0;
+  int repeats = 1, numRandom = 1;
+  unsigned long seed = 1;
+  std::vector<std::string> methodNames, shapes;
+
+  int long_opt_index = 0;
+  option long_options[] = {
+      {"help", 0, nullptr, 'h'}, {"version", 0, nullptr, 'v'}, {nullptr, 0, nullptr, 0}};
+  int c;
+  while ((c = getopt_long(argc, argv, "m:g:n:R:dt:r:j:hqv", long_options, &long_opt_index)) !=
+         -1) {
+    switch (c) {
+    case 'v':
+      PrintBanner(std::cerr);
+      exit(0);
+    case 'm': {
+      std::istringstream stream(optarg);
+      std::string name;
+      while (std::getline(stream, name, ',')) {
+        if (!GetMethods().contains(name)) {
+          std::cerr << argv[0] << ": Unknown method `" << name << "'.\n";
+          return 1;
+        }
+        methodNames.push_back(name);
+      }
+      break;
+    }
+    case 'g':
+      shapes.emplace_back(optarg);
+      break;
+    case 'n':
+      numRandom = atoi(optarg);
+      break;
+    case 'R':
+      seed = std::stoul(optarg);
+      break;
+    case 'd':
+      options.useFloat = true;
+      break;
+    case 't':
+      timeLimit = atof(optarg);
+      break;
+    case 'r':
+      repeats = std::max(1, atoi(optarg));
+      break;
+    case 'j':
+      options.numThreads = GetNumThreads(atoi(optarg));
+      break;
+    case 'h':
+      PrintHelp(argv[0]);
+      break;
+    case 'q':
+      quiet = true;
+      break;
+    case '?':
+      if (isprint(optopt)) {
+        std::cerr << argv[0] << ": Unknown option `-" << static_cast<char>(optopt) << "'.\n";
+      }
+      else {
+        std::cerr << argv[0] << ": Unknown option character `\\x" << optopt << "`.\n";
+      }
+      return 1;
+    default:
+      abort();
+    }
+  }
+
+  if (!quiet) {
+    PrintBanner(std::cerr);
+  }
+  if (methodNames.empty()) {
+    for (const auto &[name, method] : GetMethods()) {
+      methodNames.push_back(name);
+    }
+  }
+
+  try {
+    std::cout << "{\n  \"gambit_version\": " << QuoteJSON(VERSION)
+              << ",\n  \"arithmetic\": " << QuoteJSON((options.useFloat) ? "float" : "rational")
+              << ",\n  \"threads\": " << options.numThreads << ",\n  \"time_limit\": " << timeLimit
+              << ",\n  \"repeats\": " << repeats << ",\n  \"seed\": " << seed
+              << ",\n  \"results\": [";
+    ResultWriter writer(std::cout);
+    auto timeGame = [&](const Game &p_game, const std::string &p_name) {
+      for (const auto &name : methodNames) {
+        writer.Write(p_name, name,
+                     TimeMethod(GetMethods().at(name), p_game, options, timeLimit, repeats));
+      }
+    };
+
+    for (int i = optind; i < argc; i++) {
+      for (const auto &[path, name] : FindGameFiles(argv[i])) {
+        Game game;
+        try {
+          std::ifstream stream(path);
+          if (!stream.is_open()) {
+            throw std::runtime_error("Unable to open file");
+          }
+          game = ReadGame(stream);
+        }
+        catch (std::exception &e) {
+          std::cerr << argv[0] << ": Skipping " << name << ": " << e.what() << std::endl;
+          continue;
+        }
+        timeGame(game, name);
+      }
+    }
+
+    std::default_random_engine engine(seed);
+    for (const auto &shape : shapes) {
+      const auto dim = ParseShape(shape);
+      for (int i = 1; i <= numRandom; i++) {
+        timeGame(NewRandomTable(dim, engine), "random/" + shape + "/" + std::to_string(i));
+      }
+    }
+    std::cout << "\n  ]\n}\n";
+    return 0;
+  }
+  catch (std::exception &e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -47,6 +47,7 @@ void PrintHelp(char *progname)
   std::cerr << "  -O FORMAT        output file format (required):\n";
   std::cerr << "     FORMAT=html   convert to HTML\n";
   std::cerr << "     FORMAT=sgame  convert to LaTeX sgame style\n";
+  std::cerr << "     FORMAT=binary convert to Gambit's binary format\n";
   std::cerr << "  -c PLAYER        the player to show on columns (default is 2)\n";
   std::cerr << "  -r PLAYER        the player to show on rows (default is 1)\n";
   std::cerr << "  -h               print this help message\n";
@@ -100,7 +101,7 @@ int main(int argc, char *argv[])
     std::cerr << argv[0] << ": Output format argument -O required.\n";
     return 1;
   }
-  else if (format != "sgame" && format != "html") {
+  else if (format != "sgame" && format != "html" && format != "binary") {
     std::cerr << argv[0] << ": Unknown output format '" << format << "'.\n";
     return 1;
   }
@@ -125,6 +126,10 @@ int main(int argc, char *argv[])
 
   try {
     const Game game = ReadGame(*input_stream);
+    if (format == "binary") {
+      WriteBinaryFile(game, std::cout);
+      return 0;
+    }
 
     if (rowPlayer < 1 || rowPlayer > static_cast<int>(game->NumPlayers())) {
       std::cerr << argv[0] << ": Player " << rowPlayer << " does not exist.\n";
@@ -61,6 +61,8 @@ void PrintHelp(char *progname)
   std::cerr << "  -d DECIMALS      compute using floating-point arithmetic;\n";
   std::cerr << "                   display results with DECIMALS digits\n";
   std::cerr << "  -c               output connectedness information\n";
+  std::cerr << "  -j THREADS       number of threads to use\n";
+  std::cerr << "                   (default is to use all available threads)\n";
   std::cerr << "  -h, --help       print this help message\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
   std::cerr << "  -v, --version    print version information\n";
@@ -73,12 +75,12 @@ int main(int argc, char *argv[])
   int c;
   bool useFloat = false, quiet = false;
   bool showConnect = false;
-  int numDecimals = 6;
+  int numDecimals = 6, numThreads = 0;
 
   int long_opt_index = 0;
   option long_options[] = {
       {"help", 0, nullptr, 'h'}, {"version", 0, nullptr, 'v'}, {nullptr, 0, nullptr, 0}};
-  while ((c = getopt_long(argc, argv, "d:vhqc", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "d:vhqcj:", long_options, &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -93,6 +95,9 @@ int main(int argc, char *argv[])
     case 'c':
       showConnect = true;
       break;
+    case 'j':
+      numThreads = atoi(optarg);
+      break;
     case 'q':
       quiet = true;
       break;
@@ -131,7 +136,8 @@ int main(int argc, char *argv[])
     if (useFloat) {
       auto renderer = MakeMixedStrategyProfileRenderer<double>(std::cout, numDecimals, false);
       auto solution = EnumMixedStrategySolveDetailed<double>(
-          game, [&](const MixedStrategyProfile<double> &p) { renderer->Render(p); });
+          game, [&](const MixedStrategyProfile<double> &p) { renderer->Render(p); },
+          CancelToken(), numThreads);
       if (showConnect) {
         PrintCliques(solution->GetCliques(), renderer);
       }
@@ -139,7 +145,8 @@ int main(int argc, char *argv[])
     else {
       auto renderer = MakeMixedStrategyProfileRenderer<Rational>(std::cout, numDecimals, false);
       auto solution = EnumMixedStrategySolveDetailed<Rational>(
-          game, [&](const MixedStrategyProfile<Rational> &p) { renderer->Render(p); });
+          game, [&](const MixedStrategyProfile<Rational> &p) { renderer->Render(p); },
+          CancelToken(), numThreads);
       if (showConnect) {
         PrintCliques(solution->GetCliques(), renderer);
       }
@@ -60,6 +60,8 @@ void PrintHelp(char *progname)
   std::cerr << "                   for roots on a single support, before giving up on that\n";
   std::cerr << "                   support (default " << Nash::kDefaultEnumPolyMaxRectangles
             << ")\n";
+  std::cerr << "  -j THREADS       number of threads to use\n";
+  std::cerr << "                   (default is to use all available threads)\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
   std::cerr << "  -V, --verbose    verbose mode (shows supports investigated)\n";
   std::cerr << "                   (default is only to show equilibria)\n";
@@ -147,7 +149,7 @@ int main(int argc, char *argv[])
   bool quiet = false;
   bool useStrategic = false;
   double maxregret = 1.0e-8;
-  int stopAfter = 0;
+  int stopAfter = 0, numThreads = 0;
   size_t maxRectangles = Nash::kDefaultEnumPolyMaxRectangles;
 
   int long_opt_index = 0;
@@ -156,7 +158,7 @@ int main(int argc, char *argv[])
                            {"verbose", 0, nullptr, 'V'},
                            {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "d:hSm:e:r:qvV", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "d:hSm:e:r:j:qvV", long_options, &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -179,6 +181,9 @@ int main(int argc, char *argv[])
     case 'r':
       maxRectangles = std::strtoull(optarg, nullptr, 10);
       break;
+    case 'j':
+      numThreads = atoi(optarg);
+      break;
     case 'q':
       quiet = true;
       break;
@@ -226,13 +231,15 @@ int main(int argc, char *argv[])
       EnumPolyStrategySolve(
           game, stopAfter, maxregret, maxRectangles,
           [](const MixedStrategyProfile<double> &eqm) { PrintProfile(std::cout, "NE", eqm); },
-          [](const EnumPolyEvent<StrategySupportProfile> &event) { PrintEnumPolyEvent(event); });
+          [](const EnumPolyEvent<StrategySupportProfile> &event) { PrintEnumPolyEvent(event); },
+          CancelToken(), numThreads);
     }
     else {
       EnumPolyBehaviorSolve(
           game, stopAfter, maxregret, maxRectangles,
           [](const MixedBehaviorProfile<double> &eqm) { PrintProfile(std::cout, "NE", eqm); },
-          [](const EnumPolyEvent<BehaviorSupportProfile> &event) { PrintEnumPolyEvent(event); });
+          [](const EnumPolyEvent<BehaviorSupportProfile> &event) { PrintEnumPolyEvent(event); },
+          CancelToken(), numThreads);
     }
     return 0;
   }
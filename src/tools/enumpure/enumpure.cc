@@ -49,6 +49,8 @@ void PrintHelp(char *progname)
   std::cerr << "  -S               report equilibria in strategies even for extensive games\n";
   std::cerr << "  -A               compute agent form equilibria\n";
   std::cerr << "  -D               print detailed information about equilibria\n";
+  std::cerr << "  -j THREADS       number of threads to use for strategic games\n";
+  std::cerr << "                   (default is to use all available threads)\n";
   std::cerr << "  -h, --help       print this help message\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
   std::cerr << "  -v, --version    print version information\n";
@@ -60,12 +62,13 @@ int main(int argc, char *argv[])
   opterr = 0;
   bool quiet = false, reportStrategic = false, solveAgent = false;
   bool printDetail = false;
+  int numThreads = 0;
 
   int long_opt_index = 0;
   option long_options[] = {
       {"help", 0, nullptr, 'h'}, {"version", 0, nullptr, 'v'}, {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "DvhqAS", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "DvhqASj:", long_options, &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -79,6 +82,9 @@ int main(int argc, char *argv[])
     case 'A':
       solveAgent = true;
       break;
+    case 'j':
+      numThreads = atoi(optarg);
+      break;
     case 'h':
       PrintHelp(argv[0]);
       break;
@@ -130,8 +136,9 @@ int main(int argc, char *argv[])
                          [&](const MixedBehaviorProfile<Rational> &p) { renderer->Render(p); });
     }
     else {
-      EnumPureStrategySolve(game,
-                            [&](const MixedStrategyProfile<Rational> &p) { renderer->Render(p); });
+      EnumPureStrategySolve(
+          game, [&](const MixedStrategyProfile<Rational> &p) { renderer->Render(p); },
+          CancelToken(), numThreads);
     }
     return 0;
   }
@@ -24,10 +24,12 @@
 #include <cmath>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <type_traits>
 #include "games.h"
 #include "tools/util.h"
 #include "solvers/gnm/gnm.h"
+#include "solvers/multistart.h"
 
 using namespace Gambit;
 using namespace Gambit::Nash;
@@ -74,6 +76,7 @@ void PrintHelp(char *progname)
   std::cerr << "Options:\n";
   std::cerr << "  -d DECIMALS      show equilibria as floating point with DECIMALS digits\n";
   std::cerr << "  -h, --help       print this help message\n";
+  std::cerr << "  -j THREADS       number of threads to use (default is all available)\n";
   std::cerr << "  -n COUNT         number of perturbation vectors to generate randomly\n";
   std::cerr << "                   (mutually exclusive with -s)\n";
   std::cerr << "  -R SEED          seed the random number generator used to generate\n";
@@ -89,6 +92,10 @@ void PrintHelp(char *progname)
             << std::to_string(GNM_LOCAL_NEWTON_MAXITS_DEFAULT) << ")\n";
   std::cerr << "  -c STEPS         number of steps in each support cell (default "
             << std::to_string(GNM_STEPS_DEFAULT) << ")\n";
+  std::cerr << "  -t SECONDS       stop after SECONDS seconds, abandoning the perturbation\n";
+  std::cerr << "                   vectors still being worked on\n";
+  std::cerr << "  -u TOLERANCE     report an equilibrium only if it differs by more than\n";
+  std::cerr << "                   TOLERANCE in some probability from those already reported\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
   std::cerr << "  -V, --verbose    verbose mode (shows intermediate output)\n";
   std::cerr << "  -v, --version    print version information\n";
@@ -99,7 +106,9 @@ int main(int argc, char *argv[])
 {
   opterr = 0;
   bool quiet = false, verbose = false, numVectorsSet = false;
-  int numDecimals = 6, numVectors = 1;
+  int numDecimals = 6, numVectors = 1, numThreads = 0;
+  double timeLimit = 0.0;
+  std::optional<double> tolerance;
   double lambdaEnd = GNM_LAMBDA_END_DEFAULT;
   int localNewtonInterval = GNM_LOCAL_NEWTON_INTERVAL_DEFAULT;
   int localNewtonMaxits = GNM_LOCAL_NEWTON_MAXITS_DEFAULT;
@@ -113,8 +122,8 @@ int main(int argc, char *argv[])
                            {"verbose", 0, nullptr, 'V'},
                            {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "d:n:s:m:f:i:c:R:qvVh", long_options, &long_opt_index)) !=
-         -1) {
+  while ((c = getopt_long(argc, argv, "d:n:s:m:f:i:c:R:j:t:u:qvVh", long_options,
+                          &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -135,6 +144,15 @@ int main(int argc, char *argv[])
     case 'R':
       seed = std::strtoul(optarg, nullptr, 10);
       break;
+    case 'j':
+      numThreads = atoi(optarg);
+      break;
+    case 't':
+      timeLimit = atof(optarg);
+      break;
+    case 'u':
+      tolerance = atof(optarg);
+      break;
     case 's':
       startFile = optarg;
       break;
@@ -221,18 +239,33 @@ int main(int argc, char *argv[])
       auto engine = MakeRandomEngine(seed);
       perts = NewRandomStrategyProfiles(game, numVectors, engine);
     }
-    for (auto pert : perts) {
-      GNMStrategySolve(
-          pert, lambdaEnd, steps, localNewtonInterval, localNewtonMaxits,
-          [renderer](const MixedStrategyProfile<double> &p_profile) {
-            renderer->Render(p_profile);
-          },
-          [renderer, verbose](const GNMEvent &p_event) {
-            if (verbose) {
-              RenderGNMEvent(p_event, renderer);
-            }
-          });
-    }
+
+    // Events are written to a buffer for each perturbation, and printed when the equilibria
+    // found from it are, so that the output of runs on different threads is not interleaved
+    std::vector<std::string> traces(perts.size());
+    MultiStartSolve(
+        perts,
+        [&](const MixedStrategyProfile<double> &p_pert, const CancelToken &p_cancel) {
+          std::ostringstream trace;
+          const auto traceRenderer =
+              MakeMixedStrategyProfileRenderer<double>(trace, numDecimals, false);
+          auto equilibria = GNMStrategySolve(
+              p_pert, lambdaEnd, steps, localNewtonInterval, localNewtonMaxits,
+              NullStrategyCallback<double>,
+              [&](const GNMEvent &p_event) {
+                if (verbose) {
+                  RenderGNMEvent(p_event, traceRenderer);
+                }
+              },
+              p_cancel);
+          traces[&p_pert - perts.data()] = trace.str();
+          return equilibria;
+        },
+        [&](const MixedStrategyProfile<double> &p_pert) {
+          std::cout << traces[&p_pert - perts.data()];
+        },
+        [renderer](const MixedStrategyProfile<double> &p_profile) { renderer->Render(p_profile); },
+        tolerance, timeLimit, CancelToken(), numThreads);
     return 0;
   }
   catch (std::exception &e) {
@@ -23,10 +23,12 @@
 #include <getopt.h>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <type_traits>
 #include "games.h"
 #include "tools/util.h"
 #include "solvers/ipa/ipa.h"
+#include "solvers/multistart.h"
 
 using namespace Gambit;
 using namespace Gambit::Nash;
@@ -67,6 +69,7 @@ void PrintHelp(char *progname)
   std::cerr << "Options:\n";
   std::cerr << "  -d DECIMALS      show equilibria as floating point with DECIMALS digits\n";
   std::cerr << "  -h, --help       print this help message\n";
+  std::cerr << "  -j THREADS       number of threads to use (default is all available)\n";
   std::cerr << "  -n COUNT         number of perturbation vectors to generate randomly\n";
   std::cerr << "                   (mutually exclusive with -s)\n";
   std::cerr << "  -R SEED          seed the random number generator used to generate\n";
@@ -74,6 +77,10 @@ void PrintHelp(char *progname)
   std::cerr << "                   entropy); requires -n\n";
   std::cerr << "  -s FILE          file containing perturbation vectors\n";
   std::cerr << "                   (mutually exclusive with -n)\n";
+  std::cerr << "  -t SECONDS       stop after SECONDS seconds, abandoning the perturbation\n";
+  std::cerr << "                   vectors still being worked on\n";
+  std::cerr << "  -u TOLERANCE     report an equilibrium only if it differs by more than\n";
+  std::cerr << "                   TOLERANCE in some probability from those already reported\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
   std::cerr << "  -V, --verbose    verbose mode (shows intermediate output)\n";
   std::cerr << "  -v, --version    print version information\n";
@@ -84,7 +91,9 @@ int main(int argc, char *argv[])
 {
   opterr = 0;
   bool quiet = false, verbose = false, numVectorsSet = false;
-  int numDecimals = 6, numVectors = 1;
+  int numDecimals = 6, numVectors = 1, numThreads = 0;
+  double timeLimit = 0.0;
+  std::optional<double> tolerance;
   std::string startFile;
   std::optional<unsigned long> seed;
 
@@ -94,7 +103,8 @@ int main(int argc, char *argv[])
                            {"verbose", 0, nullptr, 'V'},
                            {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "d:n:s:R:vVqh", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "d:n:s:R:j:t:u:vVqh", long_options,
+                          &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -115,6 +125,15 @@ int main(int argc, char *argv[])
     case 'R':
       seed = std::strtoul(optarg, nullptr, 10);
       break;
+    case 'j':
+      numThreads = atoi(optarg);
+      break;
+    case 't':
+      timeLimit = atof(optarg);
+      break;
+    case 'u':
+      tolerance = atof(optarg);
+      break;
     case 's':
       startFile = optarg;
       break;
@@ -175,18 +194,31 @@ int main(int argc, char *argv[])
       perts = NewRandomStrategyProfiles(game, numVectors, engine);
     }
 
-    for (auto pert : perts) {
-      IPAStrategySolve(
-          pert,
-          [renderer](const MixedStrategyProfile<double> &p_profile) {
-            renderer->Render(p_profile);
-          },
-          [renderer, verbose](const IPAEvent &p_event) {
-            if (verbose) {
-              RenderIPAEvent(p_event, renderer);
-            }
-          });
-    }
+    // Events are written to a buffer for each perturbation, and printed when the equilibria
+    // found from it are, so that the output of runs on different threads is not interleaved
+    std::vector<std::string> traces(perts.size());
+    MultiStartSolve(
+        perts,
+        [&](const MixedStrategyProfile<double> &p_pert, const CancelToken &p_cancel) {
+          std::ostringstream trace;
+          const auto traceRenderer =
+              MakeMixedStrategyProfileRenderer<double>(trace, numDecimals, false);
+          auto equilibria = IPAStrategySolve(
+              p_pert, NullStrategyCallback<double>,
+              [&](const IPAEvent &p_event) {
+                if (verbose) {
+                  RenderIPAEvent(p_event, traceRenderer);
+                }
+              },
+              p_cancel);
+          traces[&p_pert - perts.data()] = trace.str();
+          return equilibria;
+        },
+        [&](const MixedStrategyProfile<double> &p_pert) {
+          std::cout << traces[&p_pert - perts.data()];
+        },
+        [renderer](const MixedStrategyProfile<double> &p_profile) { renderer->Render(p_profile); },
+        tolerance, timeLimit, CancelToken(), numThreads);
     return 0;
   }
   catch (std::exception &e) {
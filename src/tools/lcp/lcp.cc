@@ -51,12 +51,16 @@ void PrintHelp(char *progname)
   std::cerr << "  -d DECIMALS      compute using floating-point arithmetic;\n";
   std::cerr << "                   display results with DECIMALS digits\n";
   std::cerr << "  -S               use strategic game\n";
+  std::cerr << "  -H               follow paths in floating-point arithmetic, certifying\n";
+  std::cerr << "                   equilibria exactly (strategic games only)\n";
   std::cerr << "  -e EQA           terminate after finding EQA equilibria\n";
   std::cerr << "                   (strategic games only; default is to find all\n";
   std::cerr << "                   accessible equilibria)\n";
   std::cerr << "  -r DEPTH         terminate recursion at DEPTH\n";
   std::cerr << "                   (strategic games only; only if number of\n";
   std::cerr << "                   equilibria sought is not 1)\n";
+  std::cerr << "  -j THREADS       number of threads to use in the search for accessible\n";
+  std::cerr << "                   equilibria (default is all available)\n";
   std::cerr << "  -D               print detailed information about equilibria\n";
   std::cerr << "  -h, --help       print this help message\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
@@ -69,13 +73,13 @@ int main(int argc, char *argv[])
   opterr = 0;
   int c;
   bool useFloat = false, useStrategic = false, quiet = false;
-  bool printDetail = false;
-  int numDecimals = 6, stopAfter = 0, maxDepth = 0;
+  bool printDetail = false, useHybrid = false;
+  int numDecimals = 6, stopAfter = 0, maxDepth = 0, numThreads = 0;
 
   int long_opt_index = 0;
   option long_options[] = {
       {"help", 0, nullptr, 'h'}, {"version", 0, nullptr, 'v'}, {nullptr, 0, nullptr, 0}};
-  while ((c = getopt_long(argc, argv, "d:DvhqSe:r:", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "d:DvhqSHe:r:j:", long_options, &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -99,9 +103,15 @@ int main(int argc, char *argv[])
     case 'r':
       maxDepth = atoi(optarg);
       break;
+    case 'j':
+      numThreads = atoi(optarg);
+      break;
     case 'S':
       useStrategic = true;
       break;
+    case 'H':
+      useHybrid = true;
+      break;
     case '?':
       if (isprint(optopt)) {
         std::cerr << argv[0] << ": Unknown option `-" << static_cast<char>(optopt) << "'.\n";
@@ -140,14 +150,23 @@ int main(int argc, char *argv[])
             MakeMixedStrategyProfileRenderer<double>(std::cout, numDecimals, printDetail);
         LcpStrategySolve<double>(
             game, stopAfter, maxDepth,
-            [&](const MixedStrategyProfile<double> &p) { renderer->Render(p); });
+            [&](const MixedStrategyProfile<double> &p) { renderer->Render(p); }, CancelToken(),
+            numThreads);
+      }
+      else if (useHybrid) {
+        auto renderer =
+            MakeMixedStrategyProfileRenderer<Rational>(std::cout, numDecimals, printDetail);
+        LcpStrategySolveHybrid(
+            game, stopAfter, maxDepth,
+            [&](const MixedStrategyProfile<Rational> &p) { renderer->Render(p); });
       }
       else {
         auto renderer =
             MakeMixedStrategyProfileRenderer<Rational>(std::cout, numDecimals, printDetail);
         LcpStrategySolve<Rational>(
             game, stopAfter, maxDepth,
-            [&](const MixedStrategyProfile<Rational> &p) { renderer->Render(p); });
+            [&](const MixedStrategyProfile<Rational> &p) { renderer->Render(p); },
+            CancelToken(), numThreads);
       }
     }
     else {
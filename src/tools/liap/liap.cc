@@ -22,11 +22,13 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <type_traits>
 #include <getopt.h>
 #include "games.h"
 #include "tools/util.h"
 #include "solvers/liap/liap.h"
+#include "solvers/multistart.h"
 
 using namespace Gambit;
 using namespace Gambit::Nash;
@@ -46,6 +48,38 @@ void RenderLiapEvent(const Renderer &p_renderer, const LiapEvent<Profile> &p_eve
       p_event);
 }
 
+/// Runs p_solve(start, onEvent, token) from each of p_starts, printing the equilibria found,
+/// and in verbose mode the events of each run.  Events are written to a buffer for each run,
+/// and printed when that run's equilibria are, so that runs on different threads are not
+/// interleaved.
+template <class Profile, class Solve, class MakeRenderer>
+void SolveFromStarts(const std::vector<Profile> &p_starts, Solve p_solve,
+                     MakeRenderer p_makeRenderer, bool p_verbose,
+                     std::optional<double> p_tolerance, double p_timeLimit, int p_numThreads)
+{
+  const auto renderer = p_makeRenderer(std::cout);
+  std::vector<std::string> traces(p_starts.size());
+  MultiStartSolve(
+      p_starts,
+      [&](const Profile &p_start, const CancelToken &p_cancel) {
+        std::ostringstream trace;
+        const auto traceRenderer = p_makeRenderer(trace);
+        auto equilibria = p_solve(
+            p_start,
+            [&](const LiapEvent<Profile> &p_event) {
+              if (p_verbose) {
+                RenderLiapEvent(traceRenderer, p_event);
+              }
+            },
+            p_cancel);
+        traces[&p_start - p_starts.data()] = trace.str();
+        return equilibria;
+      },
+      [&](const Profile &p_start) { std::cout << traces[&p_start - p_starts.data()]; },
+      [&](const Profile &p_profile) { renderer->Render(p_profile); }, p_tolerance, p_timeLimit,
+      CancelToken(), p_numThreads);
+}
+
 void PrintBanner(std::ostream &p_stream)
 {
   p_stream << "Compute Nash equilibria by minimizing the Lyapunov function\n";
@@ -70,10 +104,15 @@ void PrintHelp(char *progname)
   std::cerr << "                   starting points (default is to seed from system entropy);\n";
   std::cerr << "                   requires -n\n";
   std::cerr << "  -i MAXITER       maximum number of iterations per point (default is 1000)\n";
+  std::cerr << "  -j THREADS       number of threads to use (default is all available)\n";
   std::cerr << "  -m MAXREGRET     maximum regret acceptable as a proportion of range of\n";
   std::cerr << "                   payoffs in the game\n";
   std::cerr << "  -s FILE          file containing starting points\n";
   std::cerr << "                   (mutually exclusive with -n)\n";
+  std::cerr << "  -t SECONDS       stop after SECONDS seconds, abandoning the starting points\n";
+  std::cerr << "                   still being worked on\n";
+  std::cerr << "  -u TOLERANCE     report an equilibrium only if it differs by more than\n";
+  std::cerr << "                   TOLERANCE in some probability from those already reported\n";
   std::cerr << "  -q               quiet mode (suppresses banner)\n";
   std::cerr << "  -V, --verbose    verbose mode (shows intermediate output)\n";
   std::cerr << "                   (default is to only show equilibria)\n";
@@ -140,7 +179,10 @@ int main(int argc, char *argv[])
   int numTries = 10;
   int maxitsN = 1000;
   int numDecimals = 6;
+  int numThreads = 0;
   double maxregret = 1.0e-4;
+  double timeLimit = 0.0;
+  std::optional<double> tolerance;
   std::string startFile;
   std::optional<unsigned long> seed;
 
@@ -150,7 +192,8 @@ int main(int argc, char *argv[])
                            {"verbose", 0, nullptr, 'V'},
                            {nullptr, 0, nullptr, 0}};
   int c;
-  while ((c = getopt_long(argc, argv, "d:n:i:s:m:R:hqVvA", long_options, &long_opt_index)) != -1) {
+  while ((c = getopt_long(argc, argv, "d:n:i:j:s:m:R:t:u:hqVvA", long_options,
+                          &long_opt_index)) != -1) {
     switch (c) {
     case 'v':
       PrintBanner(std::cerr);
@@ -171,6 +214,15 @@ int main(int argc, char *argv[])
     case 'i':
       maxitsN = atoi(optarg);
       break;
+    case 'j':
+      numThreads = atoi(optarg);
+      break;
+    case 't':
+      timeLimit = atof(optarg);
+      break;
+    case 'u':
+      tolerance = atof(optarg);
+      break;
     case 's':
       startFile = optarg;
       break;
@@ -239,19 +291,17 @@ int main(int argc, char *argv[])
         starts = NewRandomStrategyProfiles(game, numTries, engine);
       }
 
-      for (const auto &start : starts) {
-        auto renderer = MakeMixedStrategyProfileRenderer<double>(std::cout, numDecimals, false);
-        LiapStrategySolve(
-            start, maxregret, maxitsN,
-            [renderer](const MixedStrategyProfile<double> &p_profile) {
-              renderer->Render(p_profile);
-            },
-            [renderer, verbose](const LiapEvent<MixedStrategyProfile<double>> &event) {
-              if (verbose) {
-                RenderLiapEvent(renderer, event);
-              }
-            });
-      }
+      SolveFromStarts(
+          starts,
+          [&](const MixedStrategyProfile<double> &p_start, const auto &p_onEvent,
+              const CancelToken &p_cancel) {
+            return LiapStrategySolve(p_start, maxregret, maxitsN, NullStrategyCallback<double>,
+                                     p_onEvent, p_cancel);
+          },
+          [numDecimals](std::ostream &p_stream) {
+            return MakeMixedStrategyProfileRenderer<double>(p_stream, numDecimals, false);
+          },
+          verbose, tolerance, timeLimit, numThreads);
     }
     else {
       std::vector<MixedBehaviorProfile<double>> starts;
@@ -265,19 +315,17 @@ int main(int argc, char *argv[])
         starts = NewRandomBehaviorProfiles(game, numTries, engine);
       }
 
-      for (const auto &start : starts) {
-        auto renderer = MakeMixedBehaviorProfileRenderer<double>(std::cout, numDecimals, false);
-        LiapAgentSolve(
-            start, maxregret, maxitsN,
-            [renderer](const MixedBehaviorProfile<double> &p_profile) {
-              renderer->Render(p_profile);
-            },
-            [renderer, verbose](const LiapEvent<MixedBehaviorProfile<double>> &event) {
-              if (verbose) {
-                RenderLiapEvent(renderer, event);
-              }
-            });
-      }
+      SolveFromStarts(
+          starts,
+          [&](const MixedBehaviorProfile<double> &p_start, const auto &p_onEvent,
+              const CancelToken &p_cancel) {
+            return LiapAgentSolve(p_start, maxregret, maxitsN, NullBehaviorCallback<double>,
+                                  p_onEvent, p_cancel);
+          },
+          [numDecimals](std::ostream &p_stream) {
+            return MakeMixedBehaviorProfileRenderer<double>(p_stream, numDecimals, false);
+          },
+          verbose, tolerance, timeLimit, numThreads);
     }
     return 0;
   }
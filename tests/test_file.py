@@ -143,6 +143,22 @@ def test_efg_payoffs_too_many():
     assert "Parse error in game file: line 5:29: Expected '}'" in str(excinfo)
 
 
+def test_efg_deep_tree():
+    """A tree much deeper than the call stack could accommodate recursively is read,
+    and written back, without exhausting the stack.
+    """
+    depth = 100000
+    lines = ['EFG 2 R "Deep tree" { "Player 1" "Player 2" }', '""']
+    for k in range(1, depth + 1):
+        lines.append(f'p "" {1 + k % 2} {k} "" {{ "stop" "go" }} 0')
+        lines.append(f't "" {k} "" {{ {k}, {-k} }}')
+    lines.append('t "" 0')
+    game = _parse_efg("\n".join(lines) + "\n")
+    assert len(game.nodes) == 2 * depth + 1
+    assert len(game.outcomes) == depth
+    assert _parse_efg(game.to_efg()).to_efg() == game.to_efg()
+
+
 def test_nfg_title_missing():
     file_text = gbt.catalog.load("journals/ijgt/selten1975/fig2").to_nfg()
     file_text = file_text.replace('"Selten (IJGT 1975) Figure 2"', "")
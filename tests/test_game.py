@@ -1,3 +1,5 @@
+import decimal
+
 import numpy as np
 import pytest
 
@@ -86,6 +88,36 @@ def test_3d_to_arrays():
     assert (c == c_).all()
 
 
+def test_float_arrays_round_trip():
+    a = np.arange(24, dtype=np.float64).reshape(2, 3, 4) / 8
+    b = -a
+    c = np.asfortranarray(a + 0.1)
+    game = gbt.Game.from_arrays(a, b, c)
+    assert game[1, 2, 3][game.players[0]] == a[1, 2, 3]
+    assert game[0, 0, 0][game.players[2]] == decimal.Decimal("0.1")
+    a_, b_, c_ = game.to_arrays(dtype=float)
+    assert a_.dtype == np.float64
+    assert (a == a_).all()
+    assert (b == b_).all()
+    assert (c == c_).all()
+
+
+def test_int_arrays_round_trip():
+    a = np.arange(-12, 12, dtype=np.int32).reshape(4, 6)
+    game = gbt.Game.from_arrays(a, 2 * a)
+    assert game[3, 5][game.players[1]] == gbt.Rational(22)
+    a_, b_ = game.to_arrays(dtype=int)
+    assert a_.dtype == np.int64
+    assert (a == a_).all()
+    assert (2 * a == b_).all()
+
+
+def test_to_arrays_int_non_integer():
+    game = gbt.Game.from_arrays([[1, 2.5], [3, 4]], [[1, 2], [3, 4]])
+    a, b = game.to_arrays(dtype=int)
+    assert a.tolist() == [[1, 2], [3, 4]]
+
+
 def test_from_dict():
     m = np.array([[8, 2], [10, 5]])
     game = gbt.Game.from_dict({"a": m, "b": m.transpose()})
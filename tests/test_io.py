@@ -193,3 +193,23 @@ def test_read_write_nfg():
     )
     double_serialized_nfg_game = deserialized_nfg_game.to_nfg()
     assert serialized_nfg_game == double_serialized_nfg_game
+
+
+def test_read_write_binary_efg():
+    efg_game = gbt.catalog.load("journals/ijgt/selten1975/fig1")
+    deserialized_efg_game = gbt.read_binary(io.BytesIO(efg_game.to_binary()))
+    assert deserialized_efg_game.to_efg() == efg_game.to_efg()
+
+
+@pytest.mark.parametrize("game_path", glob(os.path.join("tests", "test_games", "*.nfg")))
+def test_read_write_binary_nfg(game_path, tmp_path):
+    nfg_game = gbt.read_nfg(game_path)
+    binary_path = tmp_path / "game.gbg"
+    nfg_game.to_binary(binary_path)
+    assert gbt.read_binary(binary_path).to_nfg() == nfg_game.to_nfg()
+
+
+def test_read_binary_invalid():
+    serialized_game = gbt.Game.new_table([2, 2]).to_binary()
+    with pytest.raises(ValueError):
+        gbt.read_binary(io.BytesIO(serialized_game[:-1]))
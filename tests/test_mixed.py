@@ -632,6 +632,15 @@ def test_payoffs_reference(
             (["1/4", "1/4", "1/4", "1/4"], ["1/4", "1/4", "1/4", "1/4"]),
         ),
         ###############################################################################
+        # 2x2 nfg in which some contingencies have no outcome
+        (games.read_from_file("2x2_missing_outcomes.nfg"), None, False, ([1, 0.5], [0.5, 1])),
+        (
+            games.read_from_file("2x2_missing_outcomes.nfg"),
+            None,
+            True,
+            ([1, "1/2"], ["1/2", 1]),
+        ),
+        ###############################################################################
         # stripped-down poker efg
         (games.create_stripped_down_poker_efg(), None, False, ((0.5, 0.25, -0.75, -1), (0.5, 0))),
         (
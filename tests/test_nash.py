@@ -3548,3 +3548,31 @@ def test_logit_solve_lambda_error_with_invalid_max_accel():
         gbt.qre.logit_solve_lambda(game=game, lam=[1, 2, 3], max_accel=0)
     with pytest.raises(ValueError, match="at least 1.0"):
         gbt.qre.logit_solve_lambda(game=game, lam=[1, 2, 3], max_accel=0.1)
+
+
+@pytest.mark.parametrize(
+    "solver",
+    [
+        gbt.nash.enumpure_solve,
+        gbt.nash.enummixed_solve,
+        gbt.nash.lcp_solve,
+        gbt.nash.lp_solve,
+        gbt.nash.logit_solve,
+        gbt.nash.enumpoly_solve,
+    ]
+)
+def test_solve_with_canceled_token(solver):
+    game = games.read_from_file("const_sum_game.nfg")
+    token = gbt.CancelToken()
+    token.cancel()
+    assert token.canceled
+    with pytest.raises(gbt.ComputationCanceledError):
+        solver(game, cancel=token)
+
+
+def test_solve_with_token_not_canceled():
+    game = games.read_from_file("const_sum_game.nfg")
+    token = gbt.CancelToken()
+    assert not token.canceled
+    result = gbt.nash.lcp_solve(game, cancel=token)
+    assert result.equilibria == gbt.nash.lcp_solve(game).equilibria